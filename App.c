@@ -13,6 +13,8 @@
 #include "Button.h"
 #include "Led.h"
 #include "Dio.h"
+#include "Debounce.h"
+#include "Event.h"
 
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void)
@@ -22,11 +24,20 @@ void Init_Task(void)
     
     /* Initialize Dio Driver */
     Dio_Init(&Dio_Configuration);
+    
+    /* Initialize the debounced levels of the switches */
+    Debounce_Init();
+    
+    /* Initialize the Button */
+    BUTTON_init();
 }
 
 /* Description: Task executes every 20 Mili-seconds to check the button state */
 void Button_Task(void)
 {
+    /* Debounce all the switches of the Debounce port table, one port read each, whatever the mode of the Button
+     * so Debounce_GetState is never stale for the other switches of the table */
+    Debounce_MainFunction();
     BUTTON_refreshState();
 }
 
@@ -36,20 +47,22 @@ void Led_Task(void)
     LED_refreshOutput();
 }
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
+/* Description: Task executes every 60 Mili-seconds to handle the events posted since its last run and toggle the led */
 void App_Task(void)
 {
-    static uint8 button_previous_state = BUTTON_RELEASED;
-    static uint8 button_current_state  = BUTTON_RELEASED;
-	
-    button_current_state = BUTTON_getState(); /* Read the button state */
-	
-    /* Only Toggle the led in case the current state of the switch is pressed
-     * and the previous state is released */ 
-    if((button_current_state == BUTTON_PRESSED) && (button_previous_state == BUTTON_RELEASED))
+    Event_Type Event;
+
+    /* All the pending events are handled, so a press and release within one period still toggles the led */
+    while(Event_Receive(&Event) == E_OK)
     {
-	LED_toggle();
+        /* Only Toggle the led on a debounced press of the switch */
+        if(Event.Type == EVENT_BUTTON_PRESSED)
+        {
+            LED_toggle();
+        }
+        else
+        {
+            /* No Action Required */
+        }
     }
-	
-    button_previous_state = button_current_state;
 }
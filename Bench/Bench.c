@@ -0,0 +1,217 @@
+ /******************************************************************************
+ *
+ * Module: Bench
+ *
+ * File Name: Bench.c
+ *
+ * Description: Micro-benchmark of Port_Init and of the Dio and Port channel and pin APIs.
+ *              It replaces main.c in the build, times every API call with the DWT
+ *              cycle counter and prints one CSV row per API and channel or pin:
+ *
+ *              api,id,det,iterations,min_cycles,median_cycles,p99_cycles[,gpio_reads,gpio_writes]
+ *
+ *              The cost of the measurement itself (an empty call through the same
+ *              function pointer) is subtracted. The host build against the register
+ *              simulator (Sim/) adds the GPIO bus reads and writes done per call; its
+ *              cycles are host time scaled to 16 MHz and mostly measure the simulator.
+ *              DET on and off are measured by two builds with DIO_DEV_ERROR_DETECT
+ *              and PORT_DEV_ERROR_DETECT changed.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "Port.h"
+#include "Dio.h"
+
+#ifdef SIM_HOST
+#include "Sim.h"
+#endif
+
+/* Number of timed calls of each API on each channel or pin */
+#define BENCH_ITERATIONS               (1000U)
+
+/* Data Watchpoint and Trace cycle counter registers */
+#define CORE_DEMCR_REG                 (*((volatile uint32 *)0xE000EDFC))
+#define DWT_CTRL_REG                   (*((volatile uint32 *)0xE0001000))
+#define DWT_CYCCNT_REG                 (*((volatile uint32 *)0xE0001004))
+#define CORE_DEMCR_TRCENA_MASK         0x01000000UL
+#define DWT_CTRL_CYCCNTENA_MASK        0x00000001UL
+
+/* JTAG pins PC0 to PC3 are never reconfigured by the benchmark */
+#define BENCH_IS_JTAG_PIN(PIN)         ((Port_Configuration.Pins[PIN].Port_Num == 2U) && (Port_Configuration.Pins[PIN].Pin_Num <= 3U))
+
+/* Type of the benchmarked call: Id is the channel or pin, Iteration the index of the call */
+typedef void (*Bench_FunctionType)(uint8 Id, uint32 Iteration);
+
+/* Cycles measured by each call of the current run */
+static uint32 Bench_Samples[BENCH_ITERATIONS];
+
+/* Cycles measured for an empty call, subtracted from every sample */
+static uint32 Bench_Overhead = 0;
+
+/*********************************************************************************************/
+static void Bench_Empty(uint8 Id, uint32 Iteration)
+{
+    (void)Id;
+    (void)Iteration;
+}
+
+/*********************************************************************************************/
+static void Bench_DioWriteChannel(uint8 Id, uint32 Iteration)
+{
+    Dio_WriteChannel(Id, (Dio_LevelType)(Iteration & STD_HIGH));
+}
+
+/*********************************************************************************************/
+static void Bench_DioReadChannel(uint8 Id, uint32 Iteration)
+{
+    (void)Iteration;
+    (void)Dio_ReadChannel(Id);
+}
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+/*********************************************************************************************/
+static void Bench_DioFlipChannel(uint8 Id, uint32 Iteration)
+{
+    (void)Iteration;
+    (void)Dio_FlipChannel(Id);
+}
+#endif
+
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+/*********************************************************************************************/
+static void Bench_PortSetPinDirection(uint8 Id, uint32 Iteration)
+{
+    /* Write the configured direction so the pin keeps working */
+    (void)Iteration;
+    Port_SetPinDirection(Id, Port_Configuration.Pins[Id].Port_Pin_Direction);
+}
+#endif
+
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+/*********************************************************************************************/
+static void Bench_PortSetPinMode(uint8 Id, uint32 Iteration)
+{
+    /* Write the configured mode so the pin keeps working */
+    (void)Iteration;
+    Port_SetPinMode(Id, Port_Configuration.Pins[Id].Port_Pin_Mode);
+}
+#endif
+
+/*********************************************************************************************/
+static void Bench_PortInit(uint8 Id, uint32 Iteration)
+{
+    /* Configure all the ports again with the same values */
+    (void)Id;
+    (void)Iteration;
+    Port_Init(&Port_Configuration);
+}
+
+/*********************************************************************************************/
+static int Bench_Compare(const void * First, const void * Second)
+{
+    uint32 A = *(const uint32 *)First;
+    uint32 B = *(const uint32 *)Second;
+
+    return (A > B) - (A < B);
+}
+
+/*********************************************************************************************/
+/* Description: Time BENCH_ITERATIONS calls, sort the samples and return their median */
+static uint32 Bench_Measure(Bench_FunctionType Function, uint8 Id)
+{
+    uint32 Iteration = 0;
+    uint32 Start = 0;
+    uint32 Cycles = 0;
+
+    for(Iteration = 0 ; Iteration < BENCH_ITERATIONS ; Iteration++)
+    {
+        Start = DWT_CYCCNT_REG;
+        Function(Id, Iteration);
+        Cycles = DWT_CYCCNT_REG - Start;
+        Bench_Samples[Iteration] = (Cycles > Bench_Overhead) ? (Cycles - Bench_Overhead) : 0;
+    }
+    qsort(Bench_Samples, BENCH_ITERATIONS, sizeof(Bench_Samples[0]), Bench_Compare);
+    return Bench_Samples[BENCH_ITERATIONS / 2];
+}
+
+/*********************************************************************************************/
+/* Description: Benchmark one API on one channel or pin and print its CSV row */
+static void Bench_Run(const char * Api, Bench_FunctionType Function, uint8 Id, uint8 Det)
+{
+    uint32 Median = 0;
+#ifdef SIM_HOST
+    Sim_AccessCountType Gpio_Count;
+
+    Sim_ResetAccessCount();
+#endif
+
+    Median = Bench_Measure(Function, Id);
+    printf("%s,%u,%s,%u,%lu,%lu,%lu", Api, (unsigned int)Id, (Det == STD_ON) ? "on" : "off",
+           (unsigned int)BENCH_ITERATIONS, (unsigned long)Bench_Samples[0], (unsigned long)Median,
+           (unsigned long)Bench_Samples[(BENCH_ITERATIONS * 99U) / 100U]);
+#ifdef SIM_HOST
+    Sim_GetAccessCount(SIM_BLOCK_GPIO, &Gpio_Count);
+    printf(",%lu,%lu", (unsigned long)(Gpio_Count.Reads / BENCH_ITERATIONS), (unsigned long)(Gpio_Count.Writes / BENCH_ITERATIONS));
+#endif
+    printf("\n");
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    uint8 Id = 0;
+
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+
+    /* Start the DWT cycle counter */
+    CORE_DEMCR_REG |= CORE_DEMCR_TRCENA_MASK;
+    DWT_CYCCNT_REG  = 0;
+    DWT_CTRL_REG   |= DWT_CTRL_CYCCNTENA_MASK;
+
+    /* Cost of the measurement itself */
+    Bench_Overhead = 0;
+    Bench_Overhead = Bench_Measure(Bench_Empty, 0);
+
+#ifdef SIM_HOST
+    printf("api,id,det,iterations,min_cycles,median_cycles,p99_cycles,gpio_reads,gpio_writes\n");
+#else
+    printf("api,id,det,iterations,min_cycles,median_cycles,p99_cycles\n");
+#endif
+
+    /* Boot time of the Port Driver */
+    Bench_Run("Port_Init", Bench_PortInit, 0, PORT_DEV_ERROR_DETECT);
+
+    for(Id = 0 ; Id < DIO_CONFIGURED_CHANNLES ; Id++)
+    {
+        Bench_Run("Dio_WriteChannel", Bench_DioWriteChannel, Id, DIO_DEV_ERROR_DETECT);
+        Bench_Run("Dio_ReadChannel", Bench_DioReadChannel, Id, DIO_DEV_ERROR_DETECT);
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+        Bench_Run("Dio_FlipChannel", Bench_DioFlipChannel, Id, DIO_DEV_ERROR_DETECT);
+#endif
+    }
+
+    for(Id = 0 ; Id < PORT_NUMBER_OF_PORT_PINS ; Id++)
+    {
+        /* With DET on only the pins changeable during run time can be used without a DET error */
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+        if(!BENCH_IS_JTAG_PIN(Id) && ((PORT_DEV_ERROR_DETECT == STD_OFF)
+           || (Port_Configuration.Pins[Id].Port_Pin_Direction_Changeable == STD_ON)))
+        {
+            Bench_Run("Port_SetPinDirection", Bench_PortSetPinDirection, Id, PORT_DEV_ERROR_DETECT);
+        }
+#endif
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+        if(!BENCH_IS_JTAG_PIN(Id) && ((PORT_DEV_ERROR_DETECT == STD_OFF)
+           || (Port_Configuration.Pins[Id].Port_Pin_Mode_Changeable == STD_ON)))
+        {
+            Bench_Run("Port_SetPinMode", Bench_PortSetPinMode, Id, PORT_DEV_ERROR_DETECT);
+        }
+#endif
+    }
+    return 0;
+}
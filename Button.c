@@ -10,50 +10,110 @@
  ******************************************************************************/
 #include "Dio.h"
 #include "Button.h"
+#include "Debounce.h"
+#include "Event.h"
+
+#if (BUTTON_EDGE_DETECTION == STD_ON)
+#include "Port.h"
+
+/* Number of BUTTON_refreshState calls without an edge closing the debounce window, at least BUTTON_DEBOUNCE_TIME */
+#define BUTTON_DEBOUNCE_REFRESHES  ((BUTTON_DEBOUNCE_TIME / BUTTON_REFRESH_PERIOD) + 1U)
+#endif
 
 
 /* Global variable to hold the button state */
 static uint8 g_button_state = BUTTON_RELEASED;
 
+#if (BUTTON_EDGE_DETECTION == STD_ON)
+/* Number of BUTTON_refreshState calls, the time base of the edges timestamps */
+static volatile uint32 g_Refresh_Count = 0;
+
+/* Timestamp of the last edge and number of edges ... volatile as they are set by the GPIO Port ISR */
+static volatile uint32 g_Edge_Time = 0;
+static volatile uint32 g_Edge_Count = 0;
+
+/* Number of edges handled by the last expired debounce window */
+static uint32 g_Handled_Edge_Count = 0;
+#endif
+
 /*******************************************************************************************************************/
-uint8 BUTTON_getState(void)
+void BUTTON_init(void)
 {
-    return g_button_state;
+#if (BUTTON_EDGE_DETECTION == STD_ON)
+    /* The button may already be pressed */
+    g_button_state = Dio_Read_SW1();
+    Port_SetEdgeCallBack(BUTTON_edgeNotification);
+#endif
 }
 
+#if (BUTTON_EDGE_DETECTION == STD_ON)
 /*******************************************************************************************************************/
-void BUTTON_refreshState(void)
+void BUTTON_edgeNotification(uint8 Port_Num, uint8 Pins_Mask)
 {
-    uint8 state = Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
-    
-    /* Count the number of Pressed times increment if the switch pressed for 20 ms */
-    static uint8 g_Pressed_Count  = 0;
+    if((Port_Num == BUTTON_PORT) && BIT_IS_SET(Pins_Mask, BUTTON_PIN_NUM))
+    {
+        /* Only the first edge of a debounce window is posted, the bounces would fill the event queue.
+         * It is the first edge or the last one is older than the debounce time, both only written here */
+        if((g_Edge_Count == 0U) || ((g_Refresh_Count - g_Edge_Time) >= BUTTON_DEBOUNCE_REFRESHES))
+        {
+            /* The GPIO Port ISRs are the only producer of their event queue */
+            (void)Event_Post(EventConf_GPIO_ISR_QUEUE, EVENT_BUTTON_EDGE, Port_Num, Pins_Mask);
+        }
+        else
+        {
+            /* No Action Required */
+        }
 
-    /* Count the number of Released times increment if the switch released for 20 ms */
-    static uint8 g_Released_Count = 0;
-    
-    if(state == BUTTON_PRESSED)
+        /* The timestamp is written before the count so a window is never seen open with an old timestamp */
+        g_Edge_Time = g_Refresh_Count;
+        g_Edge_Count++;
+    }
+}
+#endif
+
+/*******************************************************************************************************************/
+/* Description: Set the new Button state and post its debounced press or release event when it changed */
+static void BUTTON_setState(uint8 State)
+{
+    if(State != g_button_state)
     {
-        g_Pressed_Count++;
-	g_Released_Count = 0;
+        g_button_state = State;
+        (void)Event_Post(EventConf_TASKS_QUEUE, (State == BUTTON_PRESSED) ? EVENT_BUTTON_PRESSED : EVENT_BUTTON_RELEASED,
+                         BUTTON_PORT, BUTTON_PIN_NUM);
     }
     else
     {
-	g_Released_Count++;
-	g_Pressed_Count = 0;
+        /* No Action Required */
     }
+}
 
-    if(g_Pressed_Count == 3)
-    {
-	g_button_state = BUTTON_PRESSED;
-	g_Pressed_Count       = 0;
-	g_Released_Count      = 0;
-    }
-    else if(g_Released_Count == 3)
+/*******************************************************************************************************************/
+uint8 BUTTON_getState(void)
+{
+    return g_button_state;
+}
+
+/*******************************************************************************************************************/
+#if (BUTTON_EDGE_DETECTION == STD_ON)
+void BUTTON_refreshState(void)
+{
+    uint32 Edge_Count = g_Edge_Count;
+    
+    g_Refresh_Count++;
+    
+    /* The button is only read when the debounce window of its last edge expired, an edge coming after
+     * Edge_Count was read keeps the window open with its new timestamp */
+    if((Edge_Count != g_Handled_Edge_Count) && ((g_Refresh_Count - g_Edge_Time) >= BUTTON_DEBOUNCE_REFRESHES))
     {
-	g_button_state = BUTTON_RELEASED;
-	g_Released_Count      = 0;
-	g_Pressed_Count       = 0;
+        g_Handled_Edge_Count = Edge_Count;
+        BUTTON_setState(Dio_Read_SW1());
     }
 }
+#else
+void BUTTON_refreshState(void)
+{
+    /* The button pin is filtered with the other switches of its port by Debounce_MainFunction */
+    BUTTON_setState((uint8)((Debounce_GetState(DebounceConf_SW1_PORT_INDEX) >> BUTTON_PIN_NUM) & 1U));
+}
+#endif
 /*******************************************************************************************************************/
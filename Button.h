@@ -23,6 +23,21 @@
 /* Set the Button Pin Number */
 #define BUTTON_PIN_NUM DioConf_SW1_CHANNEL_NUM
 
+/*
+ * Pre-compile option for the edge interrupt detection of the button, the button pin shall be configured
+ * with an edge interrupt on both edges in the Port configuration. With STD_OFF the button is polled through the Debounce Module.
+ */
+#define BUTTON_EDGE_DETECTION   (STD_ON)
+
+/* Period in ms of the BUTTON_refreshState calls by the Os Task */
+#define BUTTON_REFRESH_PERIOD   (20U)
+
+/* Debounce window in ms restarted by each edge, the button level is taken once no edge came during the window */
+#define BUTTON_DEBOUNCE_TIME    (20U)
+
+
+/* Description: Initialize the Button, in the edge detection mode it sets the Port edge call back */
+void BUTTON_init(void);
 
 /* Description: Read the Button state Pressed/Released */
 uint8 BUTTON_getState(void);
@@ -31,7 +46,14 @@ uint8 BUTTON_getState(void);
  * Description: This function is called every 20ms by Os Task and it responsible for Updating 
  *              the BUTTON State. it should be in a PRESSED State if the button is pressed for 60ms.
  *		and it should be in a RELEASED State if the button is released for 60ms.
+ *		In the edge detection mode the button is only read once its debounce window expired,
+ *		otherwise the state is taken from the Debounce Module updated by the same Os Task.
  */   
 void BUTTON_refreshState(void);
 
+#if (BUTTON_EDGE_DETECTION == STD_ON)
+/* Description: Port edge call back, restarts the debounce window on each edge of the button pin */
+void BUTTON_edgeNotification(uint8 Port_Num, uint8 Pins_Mask);
+#endif
+
 #endif /* BUTTON_H */
@@ -0,0 +1,101 @@
+ /******************************************************************************
+ *
+ * Module: Debounce
+ *
+ * File Name: Debounce.c
+ *
+ * Description: Source file for Debounce Module.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Debounce.h"
+
+/* Description: Structure to hold the filter of one debounced port, one bit per pin in each member */
+typedef struct
+{
+    uint8 State;    /* debounced levels */
+    uint8 Count0;   /* bit 0 of the sample counter of each pin */
+    uint8 Count1;   /* bit 1 of the sample counter of each pin */
+    uint8 Changes;  /* pins whose debounced level changed at the last update */
+}Debounce_FilterType;
+
+/* Filter of each port of the port table */
+static Debounce_FilterType g_Debounce_Filters[DEBOUNCE_NUMBER_OF_PORTS];
+
+/*********************************************************************************************/
+void Debounce_Init(void)
+{
+    uint8 Port_Count = 0;
+
+    for(Port_Count = 0 ; Port_Count < DEBOUNCE_NUMBER_OF_PORTS ; Port_Count++)
+    {
+        g_Debounce_Filters[Port_Count].State   = Dio_ReadPort(Debounce_Ports[Port_Count].Port_Num) & Debounce_Ports[Port_Count].Pins_Mask;
+        g_Debounce_Filters[Port_Count].Count0  = 0;
+        g_Debounce_Filters[Port_Count].Count1  = 0;
+        g_Debounce_Filters[Port_Count].Changes = 0;
+    }
+}
+
+/*********************************************************************************************/
+/*
+ * Description: The sample counter of a pin counts the consecutive samples differing from its debounced level
+ * (01, 10, 11) and is cleared by any sample equal to it. The pins reaching 11 take the sampled level and their
+ * counter is cleared.
+ */
+void Debounce_MainFunction(void)
+{
+    uint8 Port_Count = 0;
+    uint8 Delta = 0;
+    Debounce_FilterType * Filter_Ptr = NULL_PTR;
+
+    for(Port_Count = 0 ; Port_Count < DEBOUNCE_NUMBER_OF_PORTS ; Port_Count++)
+    {
+        Filter_Ptr = &g_Debounce_Filters[Port_Count];
+
+        /* Pins whose sample differs from the debounced level */
+        Delta = (uint8)((Dio_ReadPort(Debounce_Ports[Port_Count].Port_Num) ^ Filter_Ptr->State) & Debounce_Ports[Port_Count].Pins_Mask);
+
+        /* Increment the counters of these pins and clear the others */
+        Filter_Ptr->Count1 = (uint8)((Filter_Ptr->Count1 ^ Filter_Ptr->Count0) & Delta);
+        Filter_Ptr->Count0 = (uint8)(~Filter_Ptr->Count0 & Delta);
+
+        /* Pins with DEBOUNCE_SAMPLES consecutive samples of the new level */
+        Filter_Ptr->Changes = (uint8)(Filter_Ptr->Count1 & Filter_Ptr->Count0);
+        Filter_Ptr->State  ^= Filter_Ptr->Changes;
+        Filter_Ptr->Count1 &= (uint8)~Filter_Ptr->Changes;
+        Filter_Ptr->Count0 &= (uint8)~Filter_Ptr->Changes;
+    }
+}
+
+/*********************************************************************************************/
+uint8 Debounce_GetState(uint8 Port_Index)
+{
+    uint8 State = 0;
+
+    if(Port_Index < DEBOUNCE_NUMBER_OF_PORTS)
+    {
+        State = g_Debounce_Filters[Port_Index].State;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return State;
+}
+
+/*********************************************************************************************/
+uint8 Debounce_GetChanges(uint8 Port_Index)
+{
+    uint8 Changes = 0;
+
+    if(Port_Index < DEBOUNCE_NUMBER_OF_PORTS)
+    {
+        Changes = g_Debounce_Filters[Port_Index].Changes;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return Changes;
+}
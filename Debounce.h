@@ -0,0 +1,56 @@
+ /******************************************************************************
+ *
+ * Module: Debounce
+ *
+ * File Name: Debounce.h
+ *
+ * Description: Header file for Debounce Module.
+ *
+ *              Each configured port is read once per Debounce_MainFunction call and all its
+ *              pins are filtered in parallel by a vertical counter: the two bits of the sample
+ *              counter of the 8 pins are held by two bit masks, so one update is a few logic
+ *              operations per port whatever the number of switches. A pin takes a new level
+ *              after DEBOUNCE_SAMPLES consecutive samples of this level.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef DEBOUNCE_H_
+#define DEBOUNCE_H_
+
+#include "Dio.h"
+
+/* Debounce Pre-Compile Configuration Header file */
+#include "Debounce_Cfg.h"
+
+/* Consecutive samples of a new level needed to change the debounced level of a pin (2-bit vertical counter) */
+#define DEBOUNCE_SAMPLES    (3U)
+
+/* Description: Structure to configure each debounced port:
+ *	1. the Dio port read by Debounce_MainFunction
+ *	2. the mask of the debounced pins of the port
+ */
+typedef struct
+{
+    Dio_PortType Port_Num;
+    uint8 Pins_Mask;
+}Debounce_PortConfigType;
+
+/* Description: Function to load the debounced levels with the current levels of the configured pins, called after Dio_Init */
+void Debounce_Init(void);
+
+/* Description: Function called periodically to read each configured port once and update the debounced levels */
+void Debounce_MainFunction(void);
+
+/* Description: Function to get the debounced levels of the configured pins of a port of the port table,
+ * the other pins read 0, returns 0 for an invalid port index */
+uint8 Debounce_GetState(uint8 Port_Index);
+
+/* Description: Function to get the configured pins of a port of the port table whose debounced level
+ * changed at the last Debounce_MainFunction call, returns 0 for an invalid port index */
+uint8 Debounce_GetChanges(uint8 Port_Index);
+
+/* Port table of the Debounce Module in Debounce_Lcfg.c */
+extern const Debounce_PortConfigType Debounce_Ports[DEBOUNCE_NUMBER_OF_PORTS];
+
+#endif /* DEBOUNCE_H_ */
@@ -0,0 +1,21 @@
+ /******************************************************************************
+ *
+ * Module: Debounce
+ *
+ * File Name: Debounce_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for Debounce Module.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef DEBOUNCE_CFG_H_
+#define DEBOUNCE_CFG_H_
+
+/* Number of the debounced ports in the port table of Debounce_Lcfg.c */
+#define DEBOUNCE_NUMBER_OF_PORTS        (1U)
+
+/* Index of the port of SW1 in the port table of Debounce_Lcfg.c */
+#define DebounceConf_SW1_PORT_INDEX     (uint8)0
+
+#endif /* DEBOUNCE_CFG_H_ */
@@ -0,0 +1,19 @@
+/******************************************************************************
+*
+* Module: Debounce
+*
+* File Name: Debounce_Lcfg.c
+*
+* Description: Link Time Configuration Source file for Debounce Module - Port table.
+*
+* Author: Mohamed Tarek
+******************************************************************************/
+
+#include "Debounce.h"
+
+/* Port table of the Debounce Module, each port is read once per Debounce_MainFunction call */
+const Debounce_PortConfigType Debounce_Ports[DEBOUNCE_NUMBER_OF_PORTS] =
+{
+    /* Port,                  Pins mask */
+    {DioConf_SW1_PORT_NUM,    (uint8)(1U << DioConf_SW1_CHANNEL_NUM)}
+};
@@ -27,6 +27,23 @@
 STATIC const Dio_ConfigChannel * Dio_PortChannels = NULL_PTR;
 STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 
+/* The ports are indexed by the same Port Id in Port_PortBaseAddress */
+#if (DIO_NUMBER_OF_PORTS != PORT_NUMBER_OF_PORTS)
+  #error "DIO_NUMBER_OF_PORTS does not match PORT_NUMBER_OF_PORTS"
+#endif
+
+/* Resolved register address and bit mask of each configured channel, filled by Dio_Init */
+STATIC Dio_ChannelRegType Dio_ChannelRegs[DIO_CONFIGURED_CHANNLES];
+
+#if (DIO_SHADOW_REGISTERS == STD_ON)
+/* RAM shadow of the output level of each port, the write APIs update it and never read GPIODATA back */
+STATIC Dio_PortLevelType Dio_PortShadow[DIO_NUMBER_OF_PORTS];
+
+/* Write the shadow level of the given pins of a port through their mask alias, other pins are not affected */
+#define DIO_PUSH_SHADOW(PORT, MASK) \
+	(*(volatile uint32 *)(Port_PortBaseAddress[(PORT)] + ((uint32)(MASK) << DIO_DATA_MASK_ADDRESS_SHIFT)) = Dio_PortShadow[(PORT)])
+#endif
+
 /************************************************************************************
 * Service Name: Dio_Init
 * Service ID[hex]: 0x10
@@ -50,12 +67,62 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 	else
 #endif
 	{
+		uint8 Ch_Count = 0; /* count to resolve each configured channel */
+#if (DIO_SHADOW_REGISTERS == STD_ON)
+		uint8 Group_Count = 0; /* count to mark the port of each configured channel group */
+		uint8 Port_Num = 0;    /* count to load the shadow of each marked port */
+		uint8 Ports_Mask = 0;  /* bit n set for each port used by a channel or a channel group */
+#endif
+
 		/*
 		 * Set the module state to initialized and point to the PB configuration structure using a global pointer.
 		 * This global pointer is global to be used by other functions to read the PB configuration structures
 		 */
 		Dio_Status       = DIO_INITIALIZED;
 		Dio_PortChannels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+
+		/* Resolve the GPIODATA register address and the bit mask of each channel once */
+		for(Ch_Count = 0 ; Ch_Count < DIO_CONFIGURED_CHANNLES ; Ch_Count++)
+		{
+			Dio_ChannelRegs[Ch_Count].Mask = (uint8)(1U << Dio_PortChannels[Ch_Count].Ch_Num);
+#if (DIO_CHANNEL_ACCESS_MODE == DIO_ACCESS_MASKED_ALIAS)
+			/* Address alias which masks every pin of the port except this channel */
+			Dio_ChannelRegs[Ch_Count].Data_Reg_Ptr = (volatile uint32 *)(Port_PortBaseAddress[Dio_PortChannels[Ch_Count].Port_Num]
+			                                         + ((uint32)Dio_ChannelRegs[Ch_Count].Mask << DIO_DATA_MASK_ADDRESS_SHIFT));
+#elif (DIO_CHANNEL_ACCESS_MODE == DIO_ACCESS_BIT_BAND)
+			/* Bit-band alias word of this channel bit in the GPIODATA register */
+			Dio_ChannelRegs[Ch_Count].Data_Reg_Ptr = (volatile uint32 *)DIO_BIT_BAND_ALIAS_ADDRESS(
+			                                         Port_PortBaseAddress[Dio_PortChannels[Ch_Count].Port_Num] + DIO_DATA_ALL_PINS_OFFSET,
+			                                         Dio_PortChannels[Ch_Count].Ch_Num);
+#else
+			/* Address which accesses all the pins of the port */
+			Dio_ChannelRegs[Ch_Count].Data_Reg_Ptr = (volatile uint32 *)(Port_PortBaseAddress[Dio_PortChannels[Ch_Count].Port_Num]
+			                                         + DIO_DATA_ALL_PINS_OFFSET);
+#endif
+#if (DIO_SHADOW_REGISTERS == STD_ON)
+			Ports_Mask |= (uint8)(1U << Dio_PortChannels[Ch_Count].Port_Num);
+#endif
+		}
+#if (DIO_SHADOW_REGISTERS == STD_ON)
+		for(Group_Count = 0 ; Group_Count < DIO_CONFIGURED_GROUPS ; Group_Count++)
+		{
+			Ports_Mask |= (uint8)(1U << ConfigPtr->Groups[Group_Count].PortIndex);
+		}
+
+		/* Load the shadow of each used port with its current output level, the only read of GPIODATA by the write APIs */
+		for(Port_Num = 0 ; Port_Num < DIO_NUMBER_OF_PORTS ; Port_Num++)
+		{
+			if(Ports_Mask & (uint8)(1U << Port_Num))
+			{
+				Dio_PortShadow[Port_Num] = (Dio_PortLevelType)(*(volatile uint32 *)
+				        (Port_PortBaseAddress[Port_Num] + DIO_DATA_ALL_PINS_OFFSET));
+			}
+			else
+			{
+				/* No Action Required ... no channel or channel group on this port */
+			}
+		}
+#endif
 	}
 }
 
@@ -73,7 +140,7 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 ************************************************************************************/
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
+	const Dio_ChannelRegType * Channel_Ptr = NULL_PTR;
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
@@ -105,32 +172,44 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
+		/* Point to the resolved register address and bit mask of this channel */
+		Channel_Ptr = &Dio_ChannelRegs[ChannelId];
+#if (DIO_SHADOW_REGISTERS == STD_ON)
+		/* Update the port shadow and write this pin from it through its mask alias */
+		if(Level == STD_HIGH)
+		{
+			Dio_PortShadow[Dio_PortChannels[ChannelId].Port_Num] |= Channel_Ptr->Mask;
+			DIO_PUSH_SHADOW(Dio_PortChannels[ChannelId].Port_Num, Channel_Ptr->Mask);
+		}
+		else if(Level == STD_LOW)
 		{
-                    case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-                    case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-                    case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
+			Dio_PortShadow[Dio_PortChannels[ChannelId].Port_Num] &= (uint8)~Channel_Ptr->Mask;
+			DIO_PUSH_SHADOW(Dio_PortChannels[ChannelId].Port_Num, Channel_Ptr->Mask);
 		}
+#else
 		if(Level == STD_HIGH)
 		{
 			/* Write Logic High */
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+#if (DIO_CHANNEL_ACCESS_MODE == DIO_ACCESS_MASKED_ALIAS)
+			*Channel_Ptr->Data_Reg_Ptr = Channel_Ptr->Mask;     /* Only this pin is affected by the alias */
+#elif (DIO_CHANNEL_ACCESS_MODE == DIO_ACCESS_BIT_BAND)
+			*Channel_Ptr->Data_Reg_Ptr = STD_HIGH;              /* The bit-band word maps to this pin only */
+#else
+			*Channel_Ptr->Data_Reg_Ptr |= Channel_Ptr->Mask;
+#endif
 		}
 		else if(Level == STD_LOW)
 		{
 			/* Write Logic Low */
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+#if (DIO_CHANNEL_ACCESS_MODE == DIO_ACCESS_MASKED_ALIAS)
+			*Channel_Ptr->Data_Reg_Ptr = 0;                     /* Only this pin is affected by the alias */
+#elif (DIO_CHANNEL_ACCESS_MODE == DIO_ACCESS_BIT_BAND)
+			*Channel_Ptr->Data_Reg_Ptr = STD_LOW;               /* The bit-band word maps to this pin only */
+#else
+			*Channel_Ptr->Data_Reg_Ptr &= ~((uint32)Channel_Ptr->Mask);
+#endif
 		}
+#endif
 	}
 	else
 	{
@@ -152,7 +231,7 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 ************************************************************************************/
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
+	const Dio_ChannelRegType * Channel_Ptr = NULL_PTR;
 	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
 
@@ -185,24 +264,14 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-                    case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-                    case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-                    case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
+		/* Point to the resolved register address and bit mask of this channel */
+		Channel_Ptr = &Dio_ChannelRegs[ChannelId];
 		/* Read the required channel */
-		if(BIT_IS_SET(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num))
+#if ((DIO_CHANNEL_ACCESS_MODE == DIO_ACCESS_MASKED_ALIAS) || (DIO_CHANNEL_ACCESS_MODE == DIO_ACCESS_BIT_BAND))
+		if(*Channel_Ptr->Data_Reg_Ptr)                          /* The alias holds this pin only */
+#else
+		if(*Channel_Ptr->Data_Reg_Ptr & Channel_Ptr->Mask)
+#endif
 		{
 			output = STD_HIGH;
 		}
@@ -218,6 +287,251 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
         return output;
 }
 
+/************************************************************************************
+* Service Name: Dio_ReadPort
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to return the level of all channels of the specified port.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
+{
+	Dio_PortLevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_NUMBER_OF_PORTS <= PortId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Read all the pins of the port in one access */
+		output = (Dio_PortLevelType)(*(volatile uint32 *)(Port_PortBaseAddress[PortId] + DIO_DATA_ALL_PINS_OFFSET));
+	}
+	else
+	{
+		/* No Action Required */
+	}
+        return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_WritePort
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the level of all channels of the specified port.
+************************************************************************************/
+void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_NUMBER_OF_PORTS <= PortId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+#if (DIO_SHADOW_REGISTERS == STD_ON)
+		/* The written level becomes the whole port shadow */
+		Dio_PortShadow[PortId] = Level;
+#endif
+		/* Write all the pins of the port in one access */
+		*(volatile uint32 *)(Port_PortBaseAddress[PortId] + DIO_DATA_ALL_PINS_OFFSET) = Level;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_ReadChannelGroup
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to read a subset of the adjoining bits of a port,
+*              the result is shifted to the right by the group offset.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr)
+{
+	Dio_PortLevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == ChannelGroupIdPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	/* Check if the port of the group is within the valid range */
+	else if (DIO_NUMBER_OF_PORTS <= ChannelGroupIdPtr->PortIndex)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Read the group pins through their mask alias, all other pins read as 0 */
+		output = (Dio_PortLevelType)(*(volatile uint32 *)(Port_PortBaseAddress[ChannelGroupIdPtr->PortIndex]
+		         + ((uint32)ChannelGroupIdPtr->mask << DIO_DATA_MASK_ADDRESS_SHIFT)) >> ChannelGroupIdPtr->offset);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+        return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_WriteChannelGroup
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set a subset of the adjoining bits of a port to a specified level,
+*              the level is shifted to the left by the group offset.
+************************************************************************************/
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr, Dio_PortLevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == ChannelGroupIdPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	/* Check if the port of the group is within the valid range */
+	else if (DIO_NUMBER_OF_PORTS <= ChannelGroupIdPtr->PortIndex)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+#if (DIO_SHADOW_REGISTERS == STD_ON)
+		/* Merge the group level into the port shadow and write the group pins from it through their mask alias */
+		Dio_PortShadow[ChannelGroupIdPtr->PortIndex] = (Dio_PortLevelType)((Dio_PortShadow[ChannelGroupIdPtr->PortIndex] & ~ChannelGroupIdPtr->mask)
+		                                               | (((uint32)Level << ChannelGroupIdPtr->offset) & ChannelGroupIdPtr->mask));
+		DIO_PUSH_SHADOW(ChannelGroupIdPtr->PortIndex, ChannelGroupIdPtr->mask);
+#else
+		/* Write all the group pins in one store through their mask alias, other pins are not affected */
+		*(volatile uint32 *)(Port_PortBaseAddress[ChannelGroupIdPtr->PortIndex]
+		  + ((uint32)ChannelGroupIdPtr->mask << DIO_DATA_MASK_ADDRESS_SHIFT)) = ((uint32)Level << ChannelGroupIdPtr->offset);
+#endif
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
 /************************************************************************************
 * Service Name: Dio_GetVersionInfo
 * Service ID[hex]: 0x12
@@ -271,7 +585,7 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
 #if (DIO_FLIP_CHANNEL_API == STD_ON)
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
+	const Dio_ChannelRegType * Channel_Ptr = NULL_PTR;
 	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
 
@@ -304,33 +618,270 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
+		/* Point to the resolved register address and bit mask of this channel */
+		Channel_Ptr = &Dio_ChannelRegs[ChannelId];
+#if (DIO_SHADOW_REGISTERS == STD_ON)
+		/* Flip the channel in the port shadow and write this pin from it, the pin is not read */
+		Dio_PortShadow[Dio_PortChannels[ChannelId].Port_Num] ^= Channel_Ptr->Mask;
+		DIO_PUSH_SHADOW(Dio_PortChannels[ChannelId].Port_Num, Channel_Ptr->Mask);
+		if(Dio_PortShadow[Dio_PortChannels[ChannelId].Port_Num] & Channel_Ptr->Mask)
+		{
+			output = STD_HIGH;
+		}
+		else
 		{
-                    case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-                    case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-                    case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
+			output = STD_LOW;
 		}
+#elif (DIO_CHANNEL_ACCESS_MODE == DIO_ACCESS_MASKED_ALIAS)
 		/* Read the required channel and write the required level */
-		if(BIT_IS_SET(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num))
+		if(*Channel_Ptr->Data_Reg_Ptr)                          /* The alias reads all other pins as 0 */
 		{
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			*Channel_Ptr->Data_Reg_Ptr = 0;
 			output = STD_LOW;
 		}
 		else
 		{
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			*Channel_Ptr->Data_Reg_Ptr = Channel_Ptr->Mask;
 			output = STD_HIGH;
 		}
+#elif (DIO_CHANNEL_ACCESS_MODE == DIO_ACCESS_BIT_BAND)
+		/* Read the required channel and write the required level */
+		/* The bit-band word reads 0 or 1 and writing it only changes this pin */
+		output = (Dio_LevelType)(*Channel_Ptr->Data_Reg_Ptr ^ STD_HIGH);
+		*Channel_Ptr->Data_Reg_Ptr = output;
+#else
+		/* Read the required channel and write the required level */
+		if(*Channel_Ptr->Data_Reg_Ptr & Channel_Ptr->Mask)
+		{
+			*Channel_Ptr->Data_Reg_Ptr &= ~((uint32)Channel_Ptr->Mask);
+			output = STD_LOW;
+		}
+		else
+		{
+			*Channel_Ptr->Data_Reg_Ptr |= Channel_Ptr->Mask;
+			output = STD_HIGH;
+		}
+#endif
+	}
+	else
+	{
+		/* No Action Required */
+	}
+        return output;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_WriteChannels
+* Service ID[hex]: 0x13
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelLevels - Pointer to a list of (ChannelId, Level) pairs.
+*                  NumberOfChannels - Number of entries in the list.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the levels of several channels, the channels are grouped
+*              by their port and each port is updated with one masked store so all its
+*              listed channels change together.
+************************************************************************************/
+#if (DIO_WRITE_CHANNELS_API == STD_ON)
+void Dio_WriteChannels(const Dio_ChannelLevelType * ChannelLevels, uint8 NumberOfChannels)
+{
+	uint8 Port_Masks[DIO_NUMBER_OF_PORTS] = {0};  /* pins of each port written by the list */
+	uint8 Port_Levels[DIO_NUMBER_OF_PORTS] = {0}; /* levels of the written pins of each port */
+	Dio_PortType Port_Num = 0;
+	uint8 Count = 0;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNELS_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == ChannelLevels)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNELS_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	else
+	{
+		/* Check if all the used channels are within the valid range before writing any of them */
+		for(Count = 0 ; Count < NumberOfChannels ; Count++)
+		{
+			if (DIO_CONFIGURED_CHANNLES <= ChannelLevels[Count].ChannelId)
+			{
+				Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+						DIO_WRITE_CHANNELS_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+				error = TRUE;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Merge the requested levels into one mask and one value per port */
+		for(Count = 0 ; Count < NumberOfChannels ; Count++)
+		{
+			Port_Num = Dio_PortChannels[ChannelLevels[Count].ChannelId].Port_Num;
+			Port_Masks[Port_Num] |= Dio_ChannelRegs[ChannelLevels[Count].ChannelId].Mask;
+			if(ChannelLevels[Count].Level == STD_HIGH)
+			{
+				Port_Levels[Port_Num] |= Dio_ChannelRegs[ChannelLevels[Count].ChannelId].Mask;
+			}
+			else
+			{
+				Port_Levels[Port_Num] &= (uint8)~Dio_ChannelRegs[ChannelLevels[Count].ChannelId].Mask;
+			}
+		}
+
+		/* Write each used port once through the mask alias of its written pins */
+		for(Port_Num = 0 ; Port_Num < DIO_NUMBER_OF_PORTS ; Port_Num++)
+		{
+			if(Port_Masks[Port_Num] != 0)
+			{
+#if (DIO_SHADOW_REGISTERS == STD_ON)
+				Dio_PortShadow[Port_Num] = (Dio_PortLevelType)((Dio_PortShadow[Port_Num] & ~Port_Masks[Port_Num]) | Port_Levels[Port_Num]);
+#endif
+				*(volatile uint32 *)(Port_PortBaseAddress[Port_Num]
+				  + ((uint32)Port_Masks[Port_Num] << DIO_DATA_MASK_ADDRESS_SHIFT)) = Port_Levels[Port_Num];
+			}
+			else
+			{
+				/* No Action Required ... no channel of this port in the list */
+			}
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_RefreshChannel
+* Service ID[hex]: 0x14
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to write the last written level of a channel again, e.g. to recover
+*              an output corrupted by noise. With the shadow registers the level is taken from
+*              the port shadow without any read, otherwise the channel is read and rewritten.
+************************************************************************************/
+void Dio_RefreshChannel(Dio_ChannelType ChannelId)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_REFRESH_CHANNEL_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_REFRESH_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+#if (DIO_SHADOW_REGISTERS == STD_ON)
+		/* Write this pin from the port shadow through its mask alias */
+		DIO_PUSH_SHADOW(Dio_PortChannels[ChannelId].Port_Num, Dio_ChannelRegs[ChannelId].Mask);
+#else
+		/* Re-write the same value */
+		Dio_WriteChannel(ChannelId, Dio_ReadChannel(ChannelId));
+#endif
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_ReadPortShadow
+* Service ID[hex]: 0x15
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to return the output level of the specified port held in its shadow,
+*              the GPIODATA register is not read.
+************************************************************************************/
+#if (DIO_SHADOW_REGISTERS == STD_ON)
+Dio_PortLevelType Dio_ReadPortShadow(Dio_PortType PortId)
+{
+	Dio_PortLevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SHADOW_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_NUMBER_OF_PORTS <= PortId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SHADOW_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		output = Dio_PortShadow[PortId];
 	}
 	else
 	{
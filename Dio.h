@@ -102,6 +102,15 @@
 /* Service ID for DIO flip Channel */
 #define DIO_FLIP_CHANNEL_SID           (uint8)0x11
 
+/* Service ID for DIO write Channels (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_WRITE_CHANNELS_SID         (uint8)0x13
+
+/* Service ID for DIO refresh Channel (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_REFRESH_CHANNEL_SID        (uint8)0x14
+
+/* Service ID for DIO read Port Shadow (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_READ_PORT_SHADOW_SID       (uint8)0x15
+
 /*******************************************************************************
  *                      DET Error Codes                                        *
  *******************************************************************************/
@@ -163,28 +172,57 @@ typedef struct
 	Dio_ChannelType Ch_Num;
 }Dio_ConfigChannel;
 
+/* Structure for one entry of the Dio_WriteChannels list */
+typedef struct
+{
+	/* ID of the DIO channel to be written */
+	Dio_ChannelType ChannelId;
+	/* Level to be written on the channel */
+	Dio_LevelType Level;
+}Dio_ChannelLevelType;
+
+/*
+ * Structure holding the resolved register access data of a configured channel:
+ * the GPIODATA register address used to access it and the bit mask of the channel.
+ * It is filled once by Dio_Init so the channel APIs need no port lookup.
+ */
+typedef struct
+{
+	/* Address of the GPIODATA register (or its per-pin mask or bit-band alias) used to access this channel */
+	volatile uint32 * Data_Reg_Ptr;
+	/* Bit mask of the channel inside the port */
+	uint8 Mask;
+}Dio_ChannelRegType;
+
 /* Data Structure required for initializing the Dio Driver */
 typedef struct Dio_ConfigType
 {
 	Dio_ConfigChannel Channels[DIO_CONFIGURED_CHANNLES];
+	Dio_ChannelGroupType Groups[DIO_CONFIGURED_GROUPS];
 } Dio_ConfigType;
 
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
 
-/* Function for DIO read Channel API */
+/* Function for DIO read Port API */
 Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId);
 
-/* Function for DIO write Channel API */
+/* Function for DIO write Port API */
 void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level);
 
-/* Function for DIO read Port API */
+/* Function for DIO read Channel API */
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId);
 
-/* Function for DIO write Port API */
+/* Function for DIO write Channel API */
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level);
 
+/* Function for DIO read Channel Group API */
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr);
+
+/* Function for DIO write Channel Group API */
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr, Dio_PortLevelType Level);
+
 /* Function for DIO Initialization API */
 void Dio_Init(const Dio_ConfigType * ConfigPtr);
 
@@ -193,11 +231,83 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr);
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId);
 #endif
 
+#if (DIO_WRITE_CHANNELS_API == STD_ON)
+/* Function for DIO write Channels API */
+void Dio_WriteChannels(const Dio_ChannelLevelType * ChannelLevels, uint8 NumberOfChannels);
+#endif
+
+/* Function for DIO refresh Channel API */
+void Dio_RefreshChannel(Dio_ChannelType ChannelId);
+
+#if (DIO_SHADOW_REGISTERS == STD_ON)
+/* Function for DIO read Port Shadow API */
+Dio_PortLevelType Dio_ReadPortShadow(Dio_PortType PortId);
+#endif
+
 /* Function for DIO Get Version Info API */
 #if (DIO_VERSION_INFO_API == STD_ON)
 void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo);
 #endif
 
+/*******************************************************************************
+ *                      Inline Channel Accessors                               *
+ *******************************************************************************/
+
+#if ((DIO_INLINE_CHANNEL_ACCESS == STD_ON) && (DIO_DEV_ERROR_DETECT == STD_OFF) && (DIO_SHADOW_REGISTERS == STD_OFF))
+
+#include "Dio_Regs.h"
+
+/*
+ * Accessors of a configured channel working directly on the constant mask alias address of the channel.
+ * The alias only affects this pin so writing all ones or all zeros sets or clears it without any branch,
+ * and reading it returns only this pin. No DET checks are done, the Port Driver must be initialized first.
+ */
+#define DIO_CHANNEL_ACCESSORS(NAME)                                                                         \
+LOCAL_INLINE void Dio_Write_##NAME(Dio_LevelType Level)                                                     \
+{                                                                                                           \
+	DIO_CHANNEL_ALIAS_REG(DioConf_##NAME##_PORT_NUM, DioConf_##NAME##_CHANNEL_NUM) = 0UL - (uint32)(Level & STD_HIGH); \
+}                                                                                                           \
+LOCAL_INLINE Dio_LevelType Dio_Read_##NAME(void)                                                            \
+{                                                                                                           \
+	return (Dio_LevelType)(DIO_CHANNEL_ALIAS_REG(DioConf_##NAME##_PORT_NUM, DioConf_##NAME##_CHANNEL_NUM)   \
+	                       >> DioConf_##NAME##_CHANNEL_NUM);                                                \
+}                                                                                                           \
+LOCAL_INLINE Dio_LevelType Dio_Flip_##NAME(void)                                                            \
+{                                                                                                           \
+	Dio_LevelType Level = Dio_Read_##NAME() ^ STD_HIGH;                                                     \
+	Dio_Write_##NAME(Level);                                                                                \
+	return Level;                                                                                           \
+}
+
+#else
+
+/* Accessors of a configured channel calling the standard channel APIs with the constant channel index */
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+#define DIO_CHANNEL_FLIP_ACCESSOR(NAME)                                                                     \
+LOCAL_INLINE Dio_LevelType Dio_Flip_##NAME(void)                                                            \
+{                                                                                                           \
+	return Dio_FlipChannel(DioConf_##NAME##_CHANNEL_ID_INDEX);                                              \
+}
+#else
+#define DIO_CHANNEL_FLIP_ACCESSOR(NAME)
+#endif
+
+#define DIO_CHANNEL_ACCESSORS(NAME)                                                                         \
+LOCAL_INLINE void Dio_Write_##NAME(Dio_LevelType Level)                                                     \
+{                                                                                                           \
+	Dio_WriteChannel(DioConf_##NAME##_CHANNEL_ID_INDEX, Level);                                             \
+}                                                                                                           \
+LOCAL_INLINE Dio_LevelType Dio_Read_##NAME(void)                                                            \
+{                                                                                                           \
+	return Dio_ReadChannel(DioConf_##NAME##_CHANNEL_ID_INDEX);                                              \
+}                                                                                                           \
+DIO_CHANNEL_FLIP_ACCESSOR(NAME)
+
+#endif
+
+/* Generate the accessors of every configured channel */
+DIO_CONFIGURED_CHANNEL_NAMES(DIO_CHANNEL_ACCESSORS)
+
 /*******************************************************************************
  *                       External Variables                                    *
  *******************************************************************************/
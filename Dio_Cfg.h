@@ -35,9 +35,42 @@
 /* Pre-compile option for presence of Dio_FlipChannel API */
 #define DIO_FLIP_CHANNEL_API                (STD_ON)
 
+/* Pre-compile option for presence of Dio_WriteChannels API */
+#define DIO_WRITE_CHANNELS_API              (STD_ON)
+
 /* Number of the configured Dio Channels */
 #define DIO_CONFIGURED_CHANNLES              (2U)
 
+/* Dio channel access modes */
+#define DIO_ACCESS_READ_MODIFY_WRITE        (0U) /* Read-modify-write on the whole GPIODATA register */
+#define DIO_ACCESS_MASKED_ALIAS             (1U) /* Single access through the per-pin GPIODATA address mask alias */
+#define DIO_ACCESS_BIT_BAND                 (2U) /* Single word access through the peripheral bit-band alias of the pin */
+
+/* Pre-compile option for the way the channel APIs access the GPIODATA register */
+#define DIO_CHANNEL_ACCESS_MODE             (DIO_ACCESS_MASKED_ALIAS)
+
+/*
+ * Pre-compile option for the inline channel accessors (Dio_Write_<Name>, Dio_Read_<Name>, Dio_Flip_<Name>).
+ * STD_ON with DIO_DEV_ERROR_DETECT and DIO_SHADOW_REGISTERS STD_OFF: each accessor is a single access
+ * to the constant mask alias address.
+ * Otherwise: each accessor calls the standard channel API with its constant channel index.
+ */
+#define DIO_INLINE_CHANNEL_ACCESS           (STD_ON)
+
+/*
+ * Pre-compile option for the RAM shadow of the output level of each port.
+ * STD_ON: the write and flip APIs update the shadow and write the pins from it without reading GPIODATA,
+ * Dio_RefreshChannel rewrites a channel from the shadow and Dio_ReadPortShadow returns it.
+ * The shadow update is a read-modify-write in RAM: a write preempted by another write on the same port
+ * loses the level of the other pin, so the write APIs of one port shall not be called from preempting contexts.
+ * The pins are always written through the mask alias, DIO_CHANNEL_ACCESS_MODE is not used, and the inline
+ * channel accessors call the standard channel APIs.
+ */
+#define DIO_SHADOW_REGISTERS                (STD_OFF)
+
+/* Number of the GPIO Ports in the Microcontroller */
+#define DIO_NUMBER_OF_PORTS                  (6U)
+
 /* Channel Index in the array of structures in Dio_PBcfg.c */
 #define DioConf_LED1_CHANNEL_ID_INDEX        (uint8)0x00
 #define DioConf_SW1_CHANNEL_ID_INDEX         (uint8)0x01
@@ -50,4 +83,18 @@
 #define DioConf_LED1_CHANNEL_NUM             (Dio_ChannelType)1 /* Pin 1 in PORTF */
 #define DioConf_SW1_CHANNEL_NUM              (Dio_ChannelType)4 /* Pin 4 in PORTF */
 
+/* Names of the configured Dio Channels used to generate the inline channel accessors */
+#define DIO_CONFIGURED_CHANNEL_NAMES(CHANNEL)   CHANNEL(LED1) CHANNEL(SW1)
+
+/* Number of the configured Dio Channel Groups */
+#define DIO_CONFIGURED_GROUPS                (1U)
+
+/* Channel Group Index in the array of structures in Dio_PBcfg.c */
+#define DioConf_LEDS_GROUP_ID_INDEX          (uint8)0x00
+
+/* DIO Configured Channel Groups: Port ID, mask of the group pins and position of the group from LSB */
+#define DioConf_LEDS_GROUP_PORT_NUM          (Dio_PortType)5 /* PORTF */
+#define DioConf_LEDS_GROUP_MASK              (uint8)0x0E     /* Pins 1, 2 and 3 in PORTF */
+#define DioConf_LEDS_GROUP_OFFSET            (uint8)1
+
 #endif /* DIO_CFG_H */
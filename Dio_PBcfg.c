@@ -41,6 +41,13 @@
 
 /* PB structure used with Dio_Init API */
 const Dio_ConfigType Dio_Configuration = {
-                                             DioConf_LED1_PORT_NUM,DioConf_LED1_CHANNEL_NUM,
-				             DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM
+                                             /* Channels: port_num, channel_num */
+                                             {
+                                               {DioConf_LED1_PORT_NUM,DioConf_LED1_CHANNEL_NUM},
+                                               {DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM}
+                                             },
+                                             /* Channel Groups: mask, offset, port_num */
+                                             {
+                                               {DioConf_LEDS_GROUP_MASK,DioConf_LEDS_GROUP_OFFSET,DioConf_LEDS_GROUP_PORT_NUM}
+                                             }
 				         };
\ No newline at end of file
@@ -13,12 +13,51 @@
 #define DIO_REGS_H
 
 #include "Std_Types.h"
+#include "Dio_Cfg.h"
+#include "Port_Regs.h"
 
-#define GPIO_PORTA_DATA_REG       (*((volatile uint32 *)0x400043FC))
-#define GPIO_PORTB_DATA_REG       (*((volatile uint32 *)0x400053FC))
-#define GPIO_PORTC_DATA_REG       (*((volatile uint32 *)0x400063FC))
-#define GPIO_PORTD_DATA_REG       (*((volatile uint32 *)0x400073FC))
-#define GPIO_PORTE_DATA_REG       (*((volatile uint32 *)0x400243FC))
-#define GPIO_PORTF_DATA_REG       (*((volatile uint32 *)0x400253FC))
+/*
+ * GPIO Ports base addresses of the Port Driver, the APB or AHB aperture is only selected
+ * by PORT_GPIO_AHB_APERTURE in Port_Cfg.h so both drivers always access the same aperture
+ */
+#define DIO_PORTA_BASE_ADDRESS    GPIO_PORTA_BASE_ADDRESS
+#define DIO_PORTB_BASE_ADDRESS    GPIO_PORTB_BASE_ADDRESS
+#define DIO_PORTC_BASE_ADDRESS    GPIO_PORTC_BASE_ADDRESS
+#define DIO_PORTD_BASE_ADDRESS    GPIO_PORTD_BASE_ADDRESS
+#define DIO_PORTE_BASE_ADDRESS    GPIO_PORTE_BASE_ADDRESS
+#define DIO_PORTF_BASE_ADDRESS    GPIO_PORTF_BASE_ADDRESS
+
+/*
+ * The GPIODATA register is decoded over offsets 0x000 to 0x3FC, address bits [9:2]
+ * act as a mask so that only the selected pins are read or written by an access.
+ */
+#define DIO_DATA_MASK_ADDRESS_SHIFT    2
+#define DIO_DATA_ALL_PINS_OFFSET       0x3FC
+
+/*
+ * Peripheral bit-band region: every bit of the peripheral region 0x40000000 to 0x400FFFFF
+ * is mapped to its own word in the alias region starting at 0x42000000
+ */
+#define DIO_PERIPHERAL_BASE_ADDRESS             0x40000000
+#define DIO_PERIPHERAL_BIT_BAND_BASE_ADDRESS    0x42000000
+#define DIO_BIT_BAND_ALIAS_ADDRESS(ADDR,BIT)    (DIO_PERIPHERAL_BIT_BAND_BASE_ADDRESS \
+                                                 + (((uint32)(ADDR) - DIO_PERIPHERAL_BASE_ADDRESS) << 5) + ((uint32)(BIT) << 2))
+
+/* Constant base address of a port from its Port Id, folded by the compiler when the Id is constant */
+#define DIO_PORT_BASE_ADDRESS(PORT)    ( ((PORT) == 0U) ? DIO_PORTA_BASE_ADDRESS : \
+                                         ((PORT) == 1U) ? DIO_PORTB_BASE_ADDRESS : \
+                                         ((PORT) == 2U) ? DIO_PORTC_BASE_ADDRESS : \
+                                         ((PORT) == 3U) ? DIO_PORTD_BASE_ADDRESS : \
+                                         ((PORT) == 4U) ? DIO_PORTE_BASE_ADDRESS : DIO_PORTF_BASE_ADDRESS )
+
+/* GPIODATA mask alias register which only accesses one pin of a port */
+#define DIO_CHANNEL_ALIAS_REG(PORT,CH) (*((volatile uint32 *)(DIO_PORT_BASE_ADDRESS(PORT) + ((1UL << (CH)) << DIO_DATA_MASK_ADDRESS_SHIFT))))
+
+#define GPIO_PORTA_DATA_REG       (*((volatile uint32 *)(DIO_PORTA_BASE_ADDRESS + DIO_DATA_ALL_PINS_OFFSET)))
+#define GPIO_PORTB_DATA_REG       (*((volatile uint32 *)(DIO_PORTB_BASE_ADDRESS + DIO_DATA_ALL_PINS_OFFSET)))
+#define GPIO_PORTC_DATA_REG       (*((volatile uint32 *)(DIO_PORTC_BASE_ADDRESS + DIO_DATA_ALL_PINS_OFFSET)))
+#define GPIO_PORTD_DATA_REG       (*((volatile uint32 *)(DIO_PORTD_BASE_ADDRESS + DIO_DATA_ALL_PINS_OFFSET)))
+#define GPIO_PORTE_DATA_REG       (*((volatile uint32 *)(DIO_PORTE_BASE_ADDRESS + DIO_DATA_ALL_PINS_OFFSET)))
+#define GPIO_PORTF_DATA_REG       (*((volatile uint32 *)(DIO_PORTF_BASE_ADDRESS + DIO_DATA_ALL_PINS_OFFSET)))
 
 #endif /* DIO_REGS_H */
@@ -0,0 +1,132 @@
+ /******************************************************************************
+ *
+ * Module: Event
+ *
+ * File Name: Event.c
+ *
+ * Description: Source file for Event Module.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Event.h"
+#include "Gpt.h"
+
+/* Mask of the queue index from the free-running head and tail indices */
+#define EVENT_INDEX_MASK        ((uint8)(EVENT_QUEUE_LENGTH - 1U))
+
+/*
+ * Description: Structure to hold one single-producer/single-consumer queue. The events are volatile so
+ * the producer stores the event before publishing it with the head and the consumer reads it before
+ * freeing it with the tail. Both sides run on the same core, so no memory barrier is needed.
+ */
+typedef struct
+{
+    volatile Event_Type Events[EVENT_QUEUE_LENGTH];
+    volatile uint8 Head;    /* events posted, written by the producer only */
+    volatile uint8 Tail;    /* events received, written by the consumer only */
+    uint32 Lost_Count;      /* events posted on the full queue, written by the producer only */
+}Event_QueueType;
+
+/* Event queues, one per producer context */
+static Event_QueueType g_Event_Queues[EVENT_NUMBER_OF_QUEUES];
+
+/*********************************************************************************************/
+Std_ReturnType Event_Post(uint8 Queue_Id, uint8 Type, uint8 Source, uint8 Data)
+{
+    Std_ReturnType Result = E_NOT_OK;
+    Event_QueueType * Queue_Ptr = NULL_PTR;
+    Event_Type Event;
+    uint8 Head = 0;
+
+    if(Queue_Id < EVENT_NUMBER_OF_QUEUES)
+    {
+        Queue_Ptr = &g_Event_Queues[Queue_Id];
+        Head = Queue_Ptr->Head;
+        if((uint8)(Head - Queue_Ptr->Tail) < EVENT_QUEUE_LENGTH)
+        {
+            Event.Time   = EVENT_TIMESTAMP();
+            Event.Type   = Type;
+            Event.Source = Source;
+            Event.Data   = Data;
+            Queue_Ptr->Events[Head & EVENT_INDEX_MASK] = Event;
+
+            /* Publish the event to the consumer */
+            Queue_Ptr->Head = (uint8)(Head + 1U);
+            Result = E_OK;
+        }
+        else
+        {
+            Queue_Ptr->Lost_Count++;
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return Result;
+}
+
+/*********************************************************************************************/
+/*
+ * Description: The pending events of each queue are in posting order, so the oldest pending event is
+ * the oldest of the first pending events of the queues, the first queue is taken on equal timestamps.
+ */
+Std_ReturnType Event_Receive(Event_Type * Event_Ptr)
+{
+    Std_ReturnType Result = E_NOT_OK;
+    Event_QueueType * Queue_Ptr = NULL_PTR;
+    uint8 Queue_Count = 0;
+    uint8 Queue_Id = EVENT_NUMBER_OF_QUEUES;
+    uint8 Tail = 0;
+    uint32 Oldest_Time = 0;
+
+    if(Event_Ptr != NULL_PTR)
+    {
+        for(Queue_Count = 0 ; Queue_Count < EVENT_NUMBER_OF_QUEUES ; Queue_Count++)
+        {
+            Queue_Ptr = &g_Event_Queues[Queue_Count];
+            Tail = Queue_Ptr->Tail;
+            /* Time differences are used so the comparison is valid across the wrap of the timestamps */
+            if((Queue_Ptr->Head != Tail)
+               && ((Queue_Id == EVENT_NUMBER_OF_QUEUES) || ((sint32)(Queue_Ptr->Events[Tail & EVENT_INDEX_MASK].Time - Oldest_Time) < 0)))
+            {
+                Queue_Id = Queue_Count;
+                Oldest_Time = Queue_Ptr->Events[Tail & EVENT_INDEX_MASK].Time;
+            }
+        }
+
+        if(Queue_Id < EVENT_NUMBER_OF_QUEUES)
+        {
+            Queue_Ptr = &g_Event_Queues[Queue_Id];
+            Tail = Queue_Ptr->Tail;
+            *Event_Ptr = Queue_Ptr->Events[Tail & EVENT_INDEX_MASK];
+
+            /* Free the slot for the producer */
+            Queue_Ptr->Tail = (uint8)(Tail + 1U);
+            Result = E_OK;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return Result;
+}
+
+/*********************************************************************************************/
+uint32 Event_GetLostCount(void)
+{
+    uint8 Queue_Count = 0;
+    uint32 Count = 0;
+
+    for(Queue_Count = 0 ; Queue_Count < EVENT_NUMBER_OF_QUEUES ; Queue_Count++)
+    {
+        Count += g_Event_Queues[Queue_Count].Lost_Count;
+    }
+    return Count;
+}
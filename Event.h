@@ -0,0 +1,60 @@
+ /******************************************************************************
+ *
+ * Module: Event
+ *
+ * File Name: Event.h
+ *
+ * Description: Header file for Event Module.
+ *
+ *              Timestamped events are passed from the ISRs and the tasks to the application
+ *              through single-producer/single-consumer ring buffers. Each queue is written by
+ *              one producer context only and read by the consumer task only, the producer owns
+ *              the head index and the consumer the tail index, so no queue access disables the
+ *              interrupts or needs LDREX/STREX.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef EVENT_H_
+#define EVENT_H_
+
+#include "Std_Types.h"
+
+/* Event Pre-Compile Configuration Header file */
+#include "Event_Cfg.h"
+
+/* Event types */
+#define EVENT_BUTTON_EDGE       (0U) /* first edge of a debounce window of a button pin, Source: port, Data: pins mask */
+#define EVENT_BUTTON_PRESSED    (1U) /* debounced press, Source: button port, Data: button pin */
+#define EVENT_BUTTON_RELEASED   (2U) /* debounced release, Source: button port, Data: button pin */
+#define EVENT_TIMER_EXPIRY      (3U) /* expiry of a timer without call back, Source: timer id low byte, Data: high byte */
+
+/* Description: Structure to hold one event:
+ *	1. the time in us when the event was posted (EVENT_TIMESTAMP)
+ *	2. the event type
+ *	3. the source and data of the event, depending on its type
+ */
+typedef struct
+{
+    uint32 Time;
+    uint8 Type;
+    uint8 Source;
+    uint8 Data;
+}Event_Type;
+
+/*
+ * Description: Function to post an event to a queue, called from the producer context of the queue only.
+ * Returns E_NOT_OK for an invalid queue or a full queue, the event is then counted as lost.
+ */
+Std_ReturnType Event_Post(uint8 Queue_Id, uint8 Type, uint8 Source, uint8 Data);
+
+/*
+ * Description: Function to get the oldest pending event of all the queues, called from the consumer task only.
+ * Returns E_NOT_OK for a NULL pointer or when no event is pending.
+ */
+Std_ReturnType Event_Receive(Event_Type * Event_Ptr);
+
+/* Description: Function to get the number of events lost on full queues since the start */
+uint32 Event_GetLostCount(void);
+
+#endif /* EVENT_H_ */
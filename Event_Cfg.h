@@ -0,0 +1,36 @@
+ /******************************************************************************
+ *
+ * Module: Event
+ *
+ * File Name: Event_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for Event Module.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef EVENT_CFG_H_
+#define EVENT_CFG_H_
+
+/* Number of the event queues, one per producer context */
+#define EVENT_NUMBER_OF_QUEUES          (3U)
+
+/* Events of each queue, a power of 2 not above 128 (the indices are free-running uint8) */
+#define EVENT_QUEUE_LENGTH              (16U)
+
+/* Queue of the events posted by the GPIO Port ISRs (button edges) */
+#define EventConf_GPIO_ISR_QUEUE        (uint8)0
+
+/* Queue of the events posted by the SysTick ISR (timer expiries of the Timer Service) */
+#define EventConf_SYSTICK_ISR_QUEUE     (uint8)1
+
+/* Queue of the events posted by the Os tasks of one level (debounced button press/release) */
+#define EventConf_TASKS_QUEUE           (uint8)2
+
+/*
+ * Timestamp of the posted events in us from the SysTick time base, it wraps after 71 minutes.
+ * Another free-running uint32 time base can be plugged here, e.g. Os_GetTime() in ms.
+ */
+#define EVENT_TIMESTAMP()               ((uint32)SysTick_GetTimeUs())
+
+#endif /* EVENT_CFG_H_ */
@@ -13,19 +13,33 @@
 #include "tm4c123gh6pm_registers.h"
 
 #define SYSTICK_PRIORITY_MASK  0x1FFFFFFF
+/* Highest priority of the ISRs reading the time base, see SysTick_GetTimeCycles */
 #define SYSTICK_INTERRUPT_PRIORITY  3
 #define SYSTICK_PRIORITY_BITS_POS   29
 
+/* Interrupt Control and State Register ... PENDSTSET bit reads 1 while the SysTick exception is pending */
+#define SCB_INT_CTRL_REG       (*((volatile uint32 *)0xE000ED04))
+#define SCB_PENDSTSET_MASK     0x04000000UL
+
 /* Global pointer to function used to point upper layer functions
  * to be used in Call Back */
 static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
 
+/* System clock cycles at the start of the current SysTick period ... volatile as it is updated by the SysTick ISR */
+static volatile uint64 g_SysTick_Period_Start = 0;
+
+/* System clock cycles of one SysTick period (Reload value + 1) */
+static uint32 g_SysTick_Period_Cycles = 0;
+
 /************************************************************************************
 * Service Name: SysTick_Handler
 * Description: SysTick Timer ISR
 ************************************************************************************/
 void SysTick_Handler(void)
 {
+    /* Start of the new period, counted before the call back so it already reads the new time */
+    g_SysTick_Period_Start += g_SysTick_Period_Cycles;
+
     /* Check if the Timer0_setCallBack is already called */
     if(g_SysTick_Call_Back_Ptr != NULL_PTR)
     {
@@ -38,7 +52,7 @@ void SysTick_Handler(void)
 * Service Name: SysTick_Start
 * Sync/Async: Synchronous
 * Reentrancy: reentrant
-* Parameters (in): Tick_Time - Time in miliseconds
+* Parameters (in): Tick_Time - Time in miliseconds, from 1 to SYSTICK_MAX_TICK_TIME
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
@@ -46,19 +60,33 @@ void SysTick_Handler(void)
 *              - Set the Reload value
 *              - Enable SysTick Timer with System clock 16Mhz
 *              - Enable SysTick Timer Interrupt and set its priority
+*              A Tick_Time out of range is ignored and the SysTick Timer is left unchanged.
 ************************************************************************************/
 void SysTick_Start(uint16 Tick_Time)
 {
-    SYSTICK_CTRL_REG    = 0;                         /* Disable the SysTick Timer by Clear the ENABLE Bit */
-    SYSTICK_RELOAD_REG  = 15999 * Tick_Time;         /* Set the Reload value to count n miliseconds */
-    SYSTICK_CURRENT_REG = 0;                         /* Clear the Current Register value */
-    /* Configure the SysTick Control Register 
-     * Enable the SysTick Timer (ENABLE = 1)
-     * Enable SysTick Interrupt (INTEN = 1)
-     * Choose the clock source to be System Clock (CLK_SRC = 1) */
-    SYSTICK_CTRL_REG   |= 0x07;
-    /* Assign priority level 3 to the SysTick Interrupt */
-    NVIC_SYSTEM_PRI3_REG =  (NVIC_SYSTEM_PRI3_REG & SYSTICK_PRIORITY_MASK) | (SYSTICK_INTERRUPT_PRIORITY << SYSTICK_PRIORITY_BITS_POS);
+    /* The period must fit the 24 bits Reload Register, a period of 0 cycles would stop the time base */
+    if((Tick_Time != 0U) && (Tick_Time <= SYSTICK_MAX_TICK_TIME))
+    {
+        SYSTICK_CTRL_REG    = 0;                         /* Disable the SysTick Timer by Clear the ENABLE Bit */
+
+        /* The time base goes on from the cycles already counted in the stopped period */
+        g_SysTick_Period_Start  = SysTick_GetTimeCycles();
+        g_SysTick_Period_Cycles = GPT_CYCLES_PER_MS * Tick_Time;
+
+        SYSTICK_RELOAD_REG  = g_SysTick_Period_Cycles - 1; /* Set the Reload value to count n miliseconds */
+        SYSTICK_CURRENT_REG = 0;                         /* Clear the Current Register value */
+        /* Configure the SysTick Control Register 
+         * Enable the SysTick Timer (ENABLE = 1)
+         * Enable SysTick Interrupt (INTEN = 1)
+         * Choose the clock source to be System Clock (CLK_SRC = 1) */
+        SYSTICK_CTRL_REG   |= 0x07;
+        /* Assign priority level 3 to the SysTick Interrupt */
+        NVIC_SYSTEM_PRI3_REG =  (NVIC_SYSTEM_PRI3_REG & SYSTICK_PRIORITY_MASK) | (SYSTICK_INTERRUPT_PRIORITY << SYSTICK_PRIORITY_BITS_POS);
+    }
+    else
+    {
+        /* No Action Required */
+    }
 }
 
 /************************************************************************************
@@ -89,4 +117,69 @@ void SysTick_Stop(void)
 void SysTick_SetCallBack(void(*Ptr2Func)(void))
 {
     g_SysTick_Call_Back_Ptr = Ptr2Func;
-}
\ No newline at end of file
+}
+
+/************************************************************************************
+* Service Name: SysTick_GetTimeCycles
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - System clock cycles since the first SysTick_Start
+* Description: Function to get a 64-bit monotonic timestamp in system clock cycles.
+*              The period start is read again after the Current Register so a SysTick ISR
+*              run between both reads restarts the read. A period that ended without its
+*              ISR (interrupts masked or a context at the SysTick priority) is seen by
+*              PENDSTSET, the Current Register is then read again as it may be taken before
+*              the end. Within the SysTick ISR, between the exception entry clearing PENDSTSET
+*              and the period start update, the read is one period late, so no caller shall
+*              preempt the SysTick ISR.
+************************************************************************************/
+uint64 SysTick_GetTimeCycles(void)
+{
+    uint64 Period_Start = 0;
+    uint64 Time = 0;
+    uint32 Current = 0;
+
+    if(g_SysTick_Period_Cycles != 0)
+    {
+        do
+        {
+            Period_Start = g_SysTick_Period_Start;
+            Current = SYSTICK_CURRENT_REG;
+            Time = Period_Start;
+            if(SCB_INT_CTRL_REG & SCB_PENDSTSET_MASK)
+            {
+                Current = SYSTICK_CURRENT_REG;
+                Time += g_SysTick_Period_Cycles;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+        } while(Period_Start != g_SysTick_Period_Start);
+
+        Time += g_SysTick_Period_Cycles - 1U - Current;
+    }
+    else
+    {
+        /* SysTick Timer never started */
+    }
+    return Time;
+}
+
+/************************************************************************************
+* Service Name: SysTick_GetTimeUs
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - Microseconds since the first SysTick_Start
+* Description: Function to get a 64-bit monotonic timestamp in microseconds.
+************************************************************************************/
+uint64 SysTick_GetTimeUs(void)
+{
+    return SysTick_GetTimeCycles() / GPT_CYCLES_PER_US;
+}
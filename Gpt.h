@@ -14,6 +14,12 @@
 
 #include "Std_Types.h"
 
+/* Gpt Pre-Compile Configuration Header file */
+#include "Gpt_Cfg.h"
+
+/* Longest Tick_Time of SysTick_Start in ms, the SysTick Reload Register is 24 bits wide (1048 ms at 16 MHz) */
+#define SYSTICK_MAX_TICK_TIME   ((uint16)(0x01000000UL / GPT_CYCLES_PER_MS))
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
@@ -22,7 +28,7 @@
 * Service Name: SysTick_Start
 * Sync/Async: Synchronous
 * Reentrancy: reentrant
-* Parameters (in): Tick_Time - Time in miliseconds
+* Parameters (in): Tick_Time - Time in miliseconds, from 1 to SYSTICK_MAX_TICK_TIME
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
@@ -30,6 +36,7 @@
 *              - Set the Reload value
 *              - Enable SysTick Timer with System clock 16Mhz
 *              - Enable SysTick Timer Interrupt and set its priority
+*              A Tick_Time out of range is ignored and the SysTick Timer is left unchanged.
 ************************************************************************************/	
 void SysTick_Start(uint16 Tick_Time);
 
@@ -57,4 +64,37 @@ void SysTick_Stop(void);
 ************************************************************************************/
 void SysTick_SetCallBack(void (*Ptr2Func)(void));
 
+/************************************************************************************
+* Service Name: SysTick_GetTimeCycles
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - System clock cycles since the first SysTick_Start
+* Description: Function to get a 64-bit monotonic timestamp in system clock cycles:
+*              the cycles of the SysTick periods counted by the SysTick ISR plus the
+*              cycles of the current period from the SysTick Current Register.
+*              It can be called from the tasks, the SysTick ISR and any ISR whose priority
+*              is not above the SysTick interrupt (3), or with the interrupts disabled: a
+*              period that ended while the SysTick interrupt is masked or pending is still
+*              counted. An ISR preempting the SysTick ISR before it counted the new period
+*              would read the time one period back, so no ISR shall be given a higher
+*              priority than SysTick (the Port Driver sets the GPIO Ports below it).
+*              The time does not advance while the SysTick Timer is stopped.
+************************************************************************************/
+uint64 SysTick_GetTimeCycles(void);
+
+/************************************************************************************
+* Service Name: SysTick_GetTimeUs
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - Microseconds since the first SysTick_Start
+* Description: Function to get a 64-bit monotonic timestamp in microseconds.
+************************************************************************************/
+uint64 SysTick_GetTimeUs(void);
+
 #endif /* GPT_H */
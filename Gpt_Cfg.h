@@ -0,0 +1,21 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - SysTick Timer Driver.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef GPT_CFG_H
+#define GPT_CFG_H
+
+/* System clock cycles per ms counted by the SysTick Timer (16 MHz system clock) */
+#define GPT_CYCLES_PER_MS   (16000UL)
+
+/* System clock cycles per us, used by SysTick_GetTimeUs */
+#define GPT_CYCLES_PER_US   (GPT_CYCLES_PER_MS / 1000UL)
+
+#endif /* GPT_CFG_H */
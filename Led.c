@@ -15,26 +15,25 @@
 /*********************************************************************************************/
 void LED_setOn(void)
 {
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_ON);  /* LED ON */
+    Dio_Write_LED1(LED_ON);  /* LED ON */
 }
 
 /*********************************************************************************************/
 void LED_setOff(void)
 {
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_OFF); /* LED OFF */
+    Dio_Write_LED1(LED_OFF); /* LED OFF */
 }
 
 /*********************************************************************************************/
 void LED_refreshOutput(void)
 {
-    Dio_LevelType state = Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX);
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,state); /* re-write the same value */
+    Dio_RefreshChannel(DioConf_LED1_CHANNEL_ID_INDEX); /* re-write the last written value */
 }
 
 /*********************************************************************************************/
 void LED_toggle(void)
 {
-    Dio_LevelType state = Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX);
+    (void)Dio_Flip_LED1();
 }
 
 /*********************************************************************************************/
@@ -14,6 +14,7 @@
 #include "Button.h"
 #include "Led.h"
 #include "Gpt.h"
+#include "Timer.h"
 
 /* Enable IRQ Interrupts ... This Macro enables IRQ interrupts by clearing the I-bit in the PRIMASK. */
 #define Enable_Interrupts()    __asm("CPSIE I")
@@ -21,15 +22,123 @@
 /* Disable IRQ Interrupts ... This Macro disables IRQ interrupts by setting the I-bit in the PRIMASK. */
 #define Disable_Interrupts()   __asm("CPSID I")
 
-/* Global variable store the Os Time */
-static uint8 g_Time_Tick_Count = 0;
+/* Wait For Interrupt ... This Macro puts the core in sleep mode until an interrupt is pending. */
+#define Wait_For_Interrupt()   __asm("WFI")
 
-/* Global variable to indicate the the timer has a new tick */
-static uint8 g_New_Time_Tick_Flag = 0;
+/* System Control Register ... SLEEPDEEP bit selects deep-sleep mode for the WFI */
+#define SCB_SYSCTRL_REG        (*((volatile uint32 *)0xE000ED10))
+#define SCB_SLEEPDEEP_MASK     0x00000004UL
+
+/* Interrupt Control and State Register ... PENDSVSET bit pends the PendSV exception */
+#define SCB_INT_CTRL_REG       (*((volatile uint32 *)0xE000ED04))
+#define SCB_PENDSVSET_MASK     0x10000000UL
+
+/* System Handler Priority 3 Register ... PendSV priority in bits 23:21, lowest priority 7 below the SysTick */
+#define SCB_SYSPRI3_REG        (*((volatile uint32 *)0xE000ED20))
+#define PENDSV_PRIORITY_MASK   0xFF1FFFFFUL
+#define PENDSV_INTERRUPT_PRIORITY   7
+#define PENDSV_PRIORITY_BITS_POS    21
+
+/* Debug Exception and Monitor Control Register and DWT cycle counter started for the measurements */
+#define CORE_DEMCR_REG         (*((volatile uint32 *)0xE000EDFC))
+#define DWT_CTRL_REG           (*((volatile uint32 *)0xE0001000))
+#define DWT_CYCCNT_REG         (*((volatile uint32 *)0xE0001004))
+#define CORE_DEMCR_TRCENA_MASK 0x01000000UL
+#define DWT_CYCCNTENA_MASK     0x00000001UL
+
+/* SysTick_Start ignores a tick time out of its range, see SYSTICK_MAX_TICK_TIME */
+#if ((OS_BASE_TIME == 0) || ((OS_BASE_TIME * GPT_CYCLES_PER_MS) > 0x01000000UL))
+  #error "OS_BASE_TIME is out of the range of SysTick_Start"
+#endif
+
+/* System clock cycles of one OS_BASE_TIME slot */
+#define OS_SLOT_CYCLES         ((uint32)OS_BASE_TIME * OS_CPU_CYCLES_PER_MS)
+
+/* Global variable store the Os Time in ms ... volatile as it is updated by the SysTick ISR */
+static volatile uint32 g_Time_Tick_Count = 0;
+
+/* Global variable to indicate the the timer has a new tick ... volatile as it is set by the SysTick ISR */
+static volatile uint8 g_New_Time_Tick_Flag = 0;
+
+/* Os time of the next run of each task of the task table */
+static uint32 g_Task_Next_Run[OS_NUMBER_OF_TASKS];
+
+/* Os time of the earliest next run of all the tasks, the task table is only scanned at this time */
+static uint32 g_Next_Due_Time = 0;
+
+/* Missed deadlines of each task of the task table */
+static uint32 g_Task_Missed_Deadlines[OS_NUMBER_OF_TASKS];
+
+/* Timer ticks that came while the previous one was still pending ... volatile as it is updated by the SysTick ISR */
+static volatile uint32 g_Missed_Tick_Count = 0;
+
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+/* Cycles spent out of the idle hook and cycle counter value at the last wake up */
+static uint64 g_Busy_Cycles = 0;
+static uint32 g_Wake_Cycle_Count = 0;
+
+/* Busy percentage of the last complete OS_CPU_LOAD_WINDOW, and the Os time and busy cycles at the window start */
+static uint8 g_Cpu_Load_Percent = 0;
+static uint32 g_Load_Window_Start_Time = 0;
+static uint64 g_Load_Window_Start_Busy = 0;
+#endif
+
+#if (OS_TASK_STATS_API == STD_ON)
+/* Execution time statistics of each task of the task table and the total cycles used for the average */
+static Os_TaskStatsType g_Task_Stats[OS_NUMBER_OF_TASKS];
+static uint64 g_Task_Total_Cycles[OS_NUMBER_OF_TASKS];
+
+/* Largest number of cycles used by the tasks of one slot */
+static uint32 g_Max_Slot_Cycles = 0;
+#endif
+
+#if ((OS_CPU_LOAD_MEASUREMENT == STD_ON) || (OS_TASK_STATS_API == STD_ON))
+/* Cycle counter value at the last timer tick, start of the current slot ... volatile as it is set by the SysTick ISR */
+static volatile uint32 g_Tick_Cycle_Count = 0;
+#endif
+
+/*********************************************************************************************/
+/* Description: First run of each task at its offset from the Os start */
+static void Os_InitTaskTable(void)
+{
+    uint8 Task_Count = 0;
+    uint32 Next_Delay = 0xFFFFFFFFUL;
+
+    for(Task_Count = 0 ; Task_Count < OS_NUMBER_OF_TASKS ; Task_Count++)
+    {
+        g_Task_Next_Run[Task_Count] = Os_Tasks[Task_Count].Offset;
+        if(Os_Tasks[Task_Count].Offset < Next_Delay)
+        {
+            Next_Delay = Os_Tasks[Task_Count].Offset;
+        }
+    }
+    g_Next_Due_Time = Next_Delay;
+}
 
 /*********************************************************************************************/
 void Os_start(void)
 {
+#if ((OS_CPU_LOAD_MEASUREMENT == STD_ON) || (OS_TASK_STATS_API == STD_ON))
+    /* Start the DWT cycle counter, the busy time is counted from here */
+    CORE_DEMCR_REG |= CORE_DEMCR_TRCENA_MASK;
+    DWT_CYCCNT_REG  = 0;
+    DWT_CTRL_REG   |= DWT_CYCCNTENA_MASK;
+#endif
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+    g_Wake_Cycle_Count = OS_CYCLE_COUNTER();
+#endif
+
+#if (OS_PREEMPTIVE == STD_ON)
+    /* PendSV at the lowest priority so it only runs once the SysTick ISR returns */
+    SCB_SYSPRI3_REG = (SCB_SYSPRI3_REG & PENDSV_PRIORITY_MASK) | ((uint32)PENDSV_INTERRUPT_PRIORITY << PENDSV_PRIORITY_BITS_POS);
+#endif
+
+    /* All the software timers stopped before the first tick */
+    Timer_Init();
+
+    /* The task table is set before the first tick, which may already run the foreground tasks from PendSV */
+    Os_InitTaskTable();
+
     /* Global Interrupts Enable */
     Enable_Interrupts();
     
@@ -52,48 +161,385 @@ void Os_start(void)
 /*********************************************************************************************/
 void Os_NewTimerTick(void)
 {
+#if ((OS_CPU_LOAD_MEASUREMENT == STD_ON) || (OS_TASK_STATS_API == STD_ON))
+    /* Start of the new slot */
+    g_Tick_Cycle_Count = OS_CYCLE_COUNTER();
+#endif
+
+    /* The Os time keeps the missed ticks, they are only counted here */
+    if(g_New_Time_Tick_Flag == 1)
+    {
+        g_Missed_Tick_Count++;
+    }
+
     /* Increment the Os time by OS_BASE_TIME */
     g_Time_Tick_Count   += OS_BASE_TIME;
 
     /* Set the flag to 1 to indicate that there is a new timer tick */
     g_New_Time_Tick_Flag = 1;
+
+    /* Expire the due software timers of the Timer Service */
+    Timer_Tick();
+
+#if (OS_PREEMPTIVE == STD_ON)
+    /* Run the due foreground tasks from PendSV once the SysTick ISR returns */
+    SCB_INT_CTRL_REG = SCB_PENDSVSET_MASK;
+#endif
 }
 
+/*********************************************************************************************/
+uint32 Os_GetTime(void)
+{
+    return g_Time_Tick_Count;
+}
+
+/*********************************************************************************************/
+/*
+ * Description: Idle hook called with the interrupts disabled when no timer tick is pending.
+ * The core sleeps until the next interrupt, which wakes it up even with the interrupts disabled.
+ * The busy cycles are counted between the wake up and the next sleep only, so the result does
+ * not depend on the cycle counter running or not while the core sleeps.
+ */
+static void Os_IdleHook(void)
+{
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+    g_Busy_Cycles += (uint32)(OS_CYCLE_COUNTER() - g_Wake_Cycle_Count);
+#endif
+
+#if (OS_IDLE_MODE == OS_IDLE_DEEP_SLEEP)
+    SCB_SYSCTRL_REG |= SCB_SLEEPDEEP_MASK;
+    Wait_For_Interrupt();
+    SCB_SYSCTRL_REG &= ~SCB_SLEEPDEEP_MASK;
+#else
+    Wait_For_Interrupt();
+#endif
+
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+    g_Wake_Cycle_Count = OS_CYCLE_COUNTER();
+#endif
+}
+
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+/*********************************************************************************************/
+void Os_GetCpuLoad(Os_CpuLoadType * Load_Ptr)
+{
+    /* Elapsed cycles since the Os start from the Os time */
+    uint64 Elapsed_Cycles = (uint64)g_Time_Tick_Count * OS_CPU_CYCLES_PER_MS;
+
+    /* Busy cycles up to now, the current busy period included */
+    Load_Ptr->Busy_Cycles = g_Busy_Cycles + (uint32)(OS_CYCLE_COUNTER() - g_Wake_Cycle_Count);
+    if(Elapsed_Cycles > Load_Ptr->Busy_Cycles)
+    {
+        Load_Ptr->Idle_Cycles = Elapsed_Cycles - Load_Ptr->Busy_Cycles;
+    }
+    else
+    {
+        Load_Ptr->Idle_Cycles = 0;
+    }
+    Load_Ptr->Load_Percent = g_Cpu_Load_Percent;
+}
+
+/*********************************************************************************************/
+/* Description: Update the rolling CPU load percentage once a complete OS_CPU_LOAD_WINDOW elapsed */
+static void Os_UpdateCpuLoad(uint32 Time)
+{
+    uint64 Busy_Cycles = 0;
+    uint64 Window_Cycles = 0;
+
+    uint32 Now = 0;
+
+    if((Time - g_Load_Window_Start_Time) >= OS_CPU_LOAD_WINDOW)
+    {
+        /*
+         * The current busy period is folded in every window, so the 32-bit cycle difference can not wrap
+         * when the CPU is overloaded and never enters the idle hook. The interrupts are disabled so a task
+         * calling Os_GetCpuLoad from PendSV never sees the busy cycles and the wake up cycle out of step.
+         */
+        Disable_Interrupts();
+        Now = OS_CYCLE_COUNTER();
+        g_Busy_Cycles += (uint32)(Now - g_Wake_Cycle_Count);
+        g_Wake_Cycle_Count = Now;
+        Enable_Interrupts();
+
+        Busy_Cycles = g_Busy_Cycles - g_Load_Window_Start_Busy;
+        Window_Cycles = (uint64)(Time - g_Load_Window_Start_Time) * OS_CPU_CYCLES_PER_MS;
+        g_Cpu_Load_Percent = (uint8)((Busy_Cycles >= Window_Cycles) ? 100U : ((Busy_Cycles * 100U) / Window_Cycles));
+        g_Load_Window_Start_Time = Time;
+        g_Load_Window_Start_Busy = g_Busy_Cycles;
+    }
+}
+#endif
+
+#if (OS_TASK_STATS_API == STD_ON)
+/*********************************************************************************************/
+Std_ReturnType Os_GetTaskStats(uint8 Task_Index, Os_TaskStatsType * Stats_Ptr)
+{
+    Std_ReturnType Result = E_NOT_OK;
+
+    if((Task_Index < OS_NUMBER_OF_TASKS) && (Stats_Ptr != NULL_PTR))
+    {
+        *Stats_Ptr = g_Task_Stats[Task_Index];
+        if(Stats_Ptr->Run_Count != 0)
+        {
+            Stats_Ptr->Average_Cycles = (uint32)(g_Task_Total_Cycles[Task_Index] / Stats_Ptr->Run_Count);
+        }
+        else
+        {
+            /* No run yet */
+            Stats_Ptr->Min_Cycles = 0;
+        }
+        Stats_Ptr->Max_Slot_Cycles = g_Max_Slot_Cycles;
+        Result = E_OK;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return Result;
+}
+
+/*********************************************************************************************/
+/* Description: Run one task and update its execution time statistics, Slot_Start is the cycle counter at the tick of its slot */
+static void Os_RunTask(uint8 Task_Index, uint32 Slot_Start)
+{
+    Os_TaskStatsType * Stats_Ptr = &g_Task_Stats[Task_Index];
+    uint32 Start = OS_CYCLE_COUNTER();
+    uint32 End = 0;
+    uint32 Cycles = 0;
+
+    (*Os_Tasks[Task_Index].Task_Ptr)();
+
+    End = OS_CYCLE_COUNTER();
+    Cycles = End - Start;
+    if((Stats_Ptr->Run_Count == 0) || (Cycles < Stats_Ptr->Min_Cycles))
+    {
+        Stats_Ptr->Min_Cycles = Cycles;
+    }
+    if(Cycles > Stats_Ptr->Max_Cycles)
+    {
+        Stats_Ptr->Max_Cycles = Cycles;
+    }
+    Stats_Ptr->Run_Count++;
+    g_Task_Total_Cycles[Task_Index] += Cycles;
+
+    /* The task overran if it ended after the end of the slot it started in */
+    if((End - Slot_Start) > OS_SLOT_CYCLES)
+    {
+        Stats_Ptr->Overrun_Count++;
+    }
+
+    /*
+     * The cycles used by the tasks of a slot run from its tick to the end of its last task, so each run
+     * updates the largest slot. The interrupts are disabled as the foreground tasks update it from PendSV.
+     */
+    Disable_Interrupts();
+    if((End - Slot_Start) > g_Max_Slot_Cycles)
+    {
+        g_Max_Slot_Cycles = End - Slot_Start;
+    }
+    Enable_Interrupts();
+}
+#endif
+
+/*********************************************************************************************/
+uint32 Os_GetMissedDeadlineCount(uint8 Task_Index)
+{
+    uint32 Count = 0;
+
+    if(Task_Index < OS_NUMBER_OF_TASKS)
+    {
+        Count = g_Task_Missed_Deadlines[Task_Index];
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return Count;
+}
+
+/*********************************************************************************************/
+uint32 Os_GetMissedTickCount(void)
+{
+    return g_Missed_Tick_Count;
+}
+
+/*********************************************************************************************/
+/*
+ * Description: Apply the miss policy of a due task before its run. Late_Periods is the number of
+ * releases of the task after the one due now that are already due too:
+ * OS_MISS_SKIP drops all of them but the latest, OS_MISS_CATCH_UP drops the ones beyond OS_MAX_CATCH_UP.
+ * Each dropped release and the run of a release one period or more late are missed deadlines.
+ */
+static void Os_ApplyMissPolicy(uint8 Task_Index, uint32 Time)
+{
+    uint32 Period = Os_Tasks[Task_Index].Period;
+    uint32 Late_Periods = (Time - g_Task_Next_Run[Task_Index]) / Period;
+    uint32 Dropped = 0;
+
+    if(Os_Tasks[Task_Index].Miss_Policy == OS_MISS_SKIP)
+    {
+        Dropped = Late_Periods;
+    }
+    else if(Late_Periods > OS_MAX_CATCH_UP)
+    {
+        Dropped = Late_Periods - OS_MAX_CATCH_UP;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+
+    g_Task_Next_Run[Task_Index] += Dropped * Period;
+    g_Task_Missed_Deadlines[Task_Index] += Dropped;
+    if(Late_Periods > Dropped)
+    {
+        /* The release run now is late by one period or more */
+        g_Task_Missed_Deadlines[Task_Index]++;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+#if (OS_PREEMPTIVE == STD_OFF)
+/*********************************************************************************************/
+/* Description: Run the tasks due at the given Os time and compute the next due time */
+static void Os_RunDueTasks(uint32 Time)
+{
+    uint8 Task_Count = 0;
+    uint32 Next_Delay = 0xFFFFFFFFUL; /* smallest delay to the next run of a task */
+#if (OS_TASK_STATS_API == STD_ON)
+    /* Start of the slot of these runs, taken before a long task lets the next tick move g_Tick_Cycle_Count */
+    uint32 Slot_Start = g_Tick_Cycle_Count;
+#endif
+
+    for(Task_Count = 0 ; Task_Count < OS_NUMBER_OF_TASKS ; Task_Count++)
+    {
+        /* Time differences are used so the comparison is valid across the wrap of the Os time */
+        if((sint32)(Time - g_Task_Next_Run[Task_Count]) >= 0)
+        {
+            Os_ApplyMissPolicy(Task_Count, Time);
+#if (OS_TASK_STATS_API == STD_ON)
+            Os_RunTask(Task_Count, Slot_Start);
+#else
+            (*Os_Tasks[Task_Count].Task_Ptr)();
+#endif
+            g_Task_Next_Run[Task_Count] += Os_Tasks[Task_Count].Period;
+        }
+        if((sint32)(g_Task_Next_Run[Task_Count] - Time) <= 0)
+        {
+            /* A late release of an OS_MISS_CATCH_UP task is still due */
+            Next_Delay = 0;
+        }
+        else if((g_Task_Next_Run[Task_Count] - Time) < Next_Delay)
+        {
+            Next_Delay = g_Task_Next_Run[Task_Count] - Time;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    g_Next_Due_Time = Time + Next_Delay;
+}
+#endif
+
+#if (OS_PREEMPTIVE == STD_ON)
+/*********************************************************************************************/
+/*
+ * Description: Run the due tasks of the foreground (priority above OS_BACKGROUND_PRIORITY) or of the
+ * background, the highest priority due task first. The Os time is read again after each run, so a
+ * task due at a tick that came meanwhile is also chosen by its priority. The tasks run to completion,
+ * the foreground ones preempt the background ones and all of them share the main stack.
+ */
+static void Os_RunLevel(boolean Foreground)
+{
+    uint8 Task_Count = 0;
+    uint8 Task_Index = 0;
+    uint32 Time = 0;
+
+    do
+    {
+        Time = g_Time_Tick_Count;
+        Task_Index = OS_NUMBER_OF_TASKS;
+        for(Task_Count = 0 ; Task_Count < OS_NUMBER_OF_TASKS ; Task_Count++)
+        {
+            if((((Os_Tasks[Task_Count].Priority > OS_BACKGROUND_PRIORITY) ? TRUE : FALSE) == Foreground)
+               && ((sint32)(Time - g_Task_Next_Run[Task_Count]) >= 0)
+               && ((Task_Index == OS_NUMBER_OF_TASKS) || (Os_Tasks[Task_Count].Priority > Os_Tasks[Task_Index].Priority)))
+            {
+                Task_Index = Task_Count;
+            }
+        }
+
+        if(Task_Index < OS_NUMBER_OF_TASKS)
+        {
+            Os_ApplyMissPolicy(Task_Index, Time);
+#if (OS_TASK_STATS_API == STD_ON)
+            /* The execution time of a background task includes the foreground tasks preempting it */
+            Os_RunTask(Task_Index, g_Tick_Cycle_Count);
+#else
+            (*Os_Tasks[Task_Index].Task_Ptr)();
+#endif
+            g_Task_Next_Run[Task_Index] += Os_Tasks[Task_Index].Period;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    } while(Task_Index < OS_NUMBER_OF_TASKS);
+}
+
+/*********************************************************************************************/
+void PendSV_Handler(void)
+{
+    Os_RunLevel(TRUE);
+}
+#endif
+
 /*********************************************************************************************/
 void Os_Scheduler(void)
 {
+    uint32 Time = 0;
+
     while(1)
     {
-	/* Code is only executed in case there is a new timer tick */
-	if(g_New_Time_Tick_Flag == 1)
-	{
-	    switch(g_Time_Tick_Count)
+        /*
+         * Enter the idle hook if no tick is pending. The interrupts are disabled while checking the flag
+         * so a tick can not be missed between the check and the WFI, the WFI still wakes up on the
+         * pending interrupt which is then served when the interrupts are enabled again.
+         */
+        Disable_Interrupts();
+        if(g_New_Time_Tick_Flag == 0)
+        {
+            Os_IdleHook();
+        }
+        Enable_Interrupts();
+
+        /* Code is only executed in case there is a new timer tick */
+        if(g_New_Time_Tick_Flag == 1)
+        {
+            g_New_Time_Tick_Flag = 0;
+            Time = g_Time_Tick_Count;
+
+            /*
+             * The task table is only scanned when at least one task is due, and scanned again while
+             * late releases of OS_MISS_CATCH_UP tasks are due (bounded by OS_MAX_CATCH_UP)
+             */
+#if (OS_PREEMPTIVE == STD_ON)
+            Os_RunLevel(FALSE);
+#else
+            while((sint32)(Time - g_Next_Due_Time) >= 0)
             {
-		case 20:
-		case 100:
-			    Button_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 40:
-		case 80:
-			    Button_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 60:
-			    Button_Task();
-			    App_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 120:
-			    Button_Task();
-			    App_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    g_Time_Tick_Count = 0;
-			    break;
+                Os_RunDueTasks(Time);
             }
-	}
+#endif
+
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+            Os_UpdateCpuLoad(Time);
+#endif
+        }
     }
 
 }
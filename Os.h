@@ -14,8 +14,54 @@
 
 #include "Std_Types.h"
 
-/* Timer counting time in ms */
-#define OS_BASE_TIME 20
+/* Os Scheduler Pre-Compile Configuration Header file */
+#include "Os_Cfg.h"
+
+/* Description: Structure to configure each task of the Os Scheduler:
+ *	1. the task function
+ *	2. the period of the task in ms --> a multiple of OS_BASE_TIME
+ *	3. the time of the first run of the task in ms --> a multiple of OS_BASE_TIME
+ *	4. the policy for the releases of the task missed while the CPU was overloaded
+ *	5. the priority of the task in the preemptive mode (OS_PREEMPTIVE), higher value for higher priority
+ */
+typedef struct
+{
+    void (*Task_Ptr)(void);
+    uint32 Period;
+    uint32 Offset;
+    uint8 Miss_Policy;
+    uint8 Priority;
+}Os_TaskConfigType;
+
+/* Policies for the missed releases of a task */
+#define OS_MISS_CATCH_UP   (0U) /* run the missed releases back to back, up to OS_MAX_CATCH_UP of them */
+#define OS_MISS_SKIP       (1U) /* drop the missed releases and run the latest one only */
+
+/* Priority of the background tasks run by the Os_Scheduler loop in the preemptive mode,
+ * the tasks of a higher priority are run from PendSV and preempt them */
+#define OS_BACKGROUND_PRIORITY  (0U)
+
+/* Description: Structure to hold the CPU load since the Os start:
+ *	1. the cycles spent running the tasks and the interrupts
+ *	2. the cycles spent in the idle hook waiting for an interrupt
+ */
+typedef struct
+{
+    uint64 Busy_Cycles;
+    uint64 Idle_Cycles;
+    uint8 Load_Percent;     /* busy percentage over the last complete OS_CPU_LOAD_WINDOW */
+}Os_CpuLoadType;
+
+/* Description: Structure to hold the execution time statistics of one task of the task table in cycles */
+typedef struct
+{
+    uint32 Run_Count;
+    uint32 Min_Cycles;
+    uint32 Max_Cycles;
+    uint32 Average_Cycles;
+    uint32 Overrun_Count;   /* runs that ended after the end of the OS_BASE_TIME slot they started in */
+    uint32 Max_Slot_Cycles; /* largest number of cycles from the tick of a slot to the end of its last task, common to all the tasks */
+}Os_TaskStatsType;
 
 /* Description: 
  * Function responsible for:
@@ -26,10 +72,42 @@
  */
 void Os_start(void);
 
-/* Description: The Engine of the Os Scheduler used for switch between different tasks */
+/* Description: The Engine of the Os Scheduler, runs the due tasks of the task table at each timer tick
+ * and sleeps until the next interrupt between the ticks */
 void Os_Scheduler(void);
 
 /* Description: Function called by the Timer Driver in the MCAL layer using the call back pointer */
 void Os_NewTimerTick(void);
 
+/* Description: Function to get the Os time in ms since the Os start, a multiple of OS_BASE_TIME */
+uint32 Os_GetTime(void);
+
+#if (OS_PREEMPTIVE == STD_ON)
+/* Description: PendSV exception handler, pended at each timer tick to run the due tasks of a priority
+ * above OS_BACKGROUND_PRIORITY, the highest priority first */
+void PendSV_Handler(void);
+#endif
+
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+/* Description: Function to get the busy and idle cycles of the CPU since the Os start */
+void Os_GetCpuLoad(Os_CpuLoadType * Load_Ptr);
+#endif
+
+#if (OS_TASK_STATS_API == STD_ON)
+/* Description: Function to get the execution time statistics of a task of the task table,
+ * returns E_NOT_OK for an invalid task index or a NULL pointer */
+Std_ReturnType Os_GetTaskStats(uint8 Task_Index, Os_TaskStatsType * Stats_Ptr);
+#endif
+
+/* Description: Function to get the number of missed deadlines of a task of the task table,
+ * a release of the task that started one period or more late or that was dropped is a missed deadline,
+ * returns 0 for an invalid task index */
+uint32 Os_GetMissedDeadlineCount(uint8 Task_Index);
+
+/* Description: Function to get the number of timer ticks that came before the scheduler handled the previous one */
+uint32 Os_GetMissedTickCount(void);
+
+/* Task table of the Os Scheduler in Os_Lcfg.c */
+extern const Os_TaskConfigType Os_Tasks[OS_NUMBER_OF_TASKS];
+
 #endif /* OS_H_ */
@@ -0,0 +1,58 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for Os Scheduler.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef OS_CFG_H_
+#define OS_CFG_H_
+
+/* Timer counting time in ms */
+#define OS_BASE_TIME 20
+
+/* Number of the tasks in the task table of Os_Lcfg.c */
+#define OS_NUMBER_OF_TASKS  (3U)
+
+/*
+ * Pre-compile option for the preemptive mode of the Os Scheduler: the tasks of a priority above
+ * OS_BACKGROUND_PRIORITY run from the PendSV exception pended by the SysTick ISR and preempt the
+ * background tasks run by the Os_Scheduler loop. With STD_OFF all the tasks run from the loop in
+ * the task table order and the priorities are not used.
+ */
+#define OS_PREEMPTIVE       (STD_OFF)
+
+/* Maximum number of late releases of an OS_MISS_CATCH_UP task run back to back, older releases are dropped */
+#define OS_MAX_CATCH_UP     (2U)
+
+/* System clock cycles per ms (16 MHz system clock also used by the SysTick Timer) */
+#define OS_CPU_CYCLES_PER_MS  (16000U)
+
+/* Idle modes of the Os Scheduler when no task is due */
+#define OS_IDLE_SLEEP         (0U) /* WFI in sleep mode, SysTick keeps running */
+#define OS_IDLE_DEEP_SLEEP    (1U) /* WFI in deep-sleep mode, the deep-sleep clock (DSLPCLKCFG) and the
+                                    * deep-sleep clock gating of the wake-up source must be set by the startup code */
+
+/* Pre-compile option for the idle mode of the Os Scheduler */
+#define OS_IDLE_MODE          (OS_IDLE_SLEEP)
+
+/* Pre-compile option for counting the busy and idle cycles of the CPU (Os_GetCpuLoad) with the DWT cycle counter */
+#define OS_CPU_LOAD_MEASUREMENT  (STD_ON)
+
+/* Length in ms of the window of the rolling CPU load percentage */
+#define OS_CPU_LOAD_WINDOW       (1000U)
+
+/* Pre-compile option for the execution time statistics of each task (Os_GetTaskStats) */
+#define OS_TASK_STATS_API        (STD_ON)
+
+/*
+ * Free-running 32-bit counter of the system clock cycles used by the measurements.
+ * DWT CYCCNT by default (started by Os_start), another clock can be plugged here, e.g. on a host build.
+ */
+#define OS_CYCLE_COUNTER()       (*((volatile uint32 *)0xE0001004))
+
+#endif /* OS_CFG_H_ */
@@ -0,0 +1,22 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Lcfg.c
+ *
+ * Description: Link Time Configuration Source file for Os Scheduler - Task table.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Os.h"
+#include "App.h"
+
+/* Task table of the Os Scheduler, the tasks due at the same tick run in the table order */
+const Os_TaskConfigType Os_Tasks[OS_NUMBER_OF_TASKS] =
+{
+    /* Task,        Period (ms), Offset (ms), Miss policy,      Priority */
+    {Button_Task,   20,          20,          OS_MISS_SKIP,     2},
+    {App_Task,      60,          60,          OS_MISS_CATCH_UP, OS_BACKGROUND_PRIORITY},
+    {Led_Task,      40,          40,          OS_MISS_SKIP,     1}
+};
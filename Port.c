@@ -27,6 +27,93 @@
 STATIC const Port_ConfigPin* Port_Pins = NULL_PTR;
 STATIC uint8 Port_Status = PORT_NOT_INITIALIZED;
 
+/* GPIO base address of each port indexed by the Port Id, shared with the Dio Driver */
+const uint32 Port_PortBaseAddress[PORT_NUMBER_OF_PORTS] =
+{
+	GPIO_PORTA_BASE_ADDRESS,
+	GPIO_PORTB_BASE_ADDRESS,
+	GPIO_PORTC_BASE_ADDRESS,
+	GPIO_PORTD_BASE_ADDRESS,
+	GPIO_PORTE_BASE_ADDRESS,
+	GPIO_PORTF_BASE_ADDRESS
+};
+
+/* Base address of the port registers of each configured pin, filled by Port_Init */
+STATIC volatile uint32 * Port_PinBaseAddress[PORT_NUMBER_OF_PORT_PINS];
+
+/* Pins of each port refreshed by Port_RefreshPortDirection and their expected direction bits, filled by Port_Init */
+STATIC uint8 Port_DirRefreshMask[PORT_NUMBER_OF_PORTS];
+STATIC uint8 Port_DirShadow[PORT_NUMBER_OF_PORTS];
+
+/* Number of ports found with a drifted direction by Port_RefreshPortDirection */
+STATIC uint32 Port_DirDriftCount = 0;
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+/* RAM shadow of the mode and direction registers of each port, filled by Port_Init */
+STATIC Port_ShadowRegType Port_Shadow[PORT_NUMBER_OF_PORTS];
+#endif
+
+#if (PORT_EDGE_INTERRUPTS == STD_ON)
+/* NVIC interrupt number of each port indexed by the Port Id */
+STATIC const uint8 Port_PortIrqNumber[PORT_NUMBER_OF_PORTS] = {0, 1, 2, 3, 4, 30};
+
+/* Priority of the GPIO Port interrupts, below the SysTick interrupt (3) as the edge call backs read its time base */
+#define PORT_EDGE_INTERRUPT_PRIORITY      5
+
+/* Upper layer function called by the GPIO Port ISRs */
+STATIC void (*Port_EdgeCallBack_Ptr)(uint8 Port_Num, uint8 Pins_Mask) = NULL_PTR;
+#endif
+
+/************************************************************************************
+* Service Name: Port_GetPinModePmc
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Pin - Port Pin ID number.
+*                  Mode - Port Pin mode, optionally with an explicit PMCx value.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint8 - PMCx value of the pin mode, PORT_PMC_ANALOG for analog functions
+*               or PORT_PMC_ILLEGAL if the mode is not available on this pin.
+* Description: Looks up how the pin is muxed for the mode in the pin mux table.
+*              The default function of the mode is used unless the mode holds the PMCx
+*              value of one of its alternative functions on this pin.
+************************************************************************************/
+STATIC uint8 Port_GetPinModePmc(Port_PinType Pin, Port_PinModeType Mode)
+{
+    Port_PinModePmcType Entry = 0;
+    uint8 Pmc = PORT_PMC_ILLEGAL;
+    uint8 Pmc_Select = (uint8)PORT_PIN_MODE_PMC(Mode);
+    
+    if(PORT_PIN_MODE_ID(Mode) < PORT_NUMBER_OF_PORT_PIN_MODES)
+    {
+      Entry = Port_PinModePmc[Pin][PORT_PIN_MODE_ID(Mode)];
+      Pmc = (uint8)Entry;
+      
+      /* Check if an alternative function of the mode is selected */
+      if( (Pmc_Select != 0) && (Pmc_Select != Pmc) )
+      {
+        if( (Pmc_Select == ((Entry >> 8) & 0x0F)) || (Pmc_Select == ((Entry >> 12) & 0x0F)) )
+        {
+          Pmc = Pmc_Select;
+        }
+        else
+        {
+          Pmc = PORT_PMC_ILLEGAL;
+        }
+      }
+      else
+      {
+        /* No Action Required */
+      }
+    }
+    else
+    {
+      /* No Action Required ... invalid mode ID */
+    }
+    
+    return Pmc;
+}
+
 /************************************************************************************
 * Service Name: Port_Init
 * Sync/Async: Synchronous
@@ -36,11 +123,27 @@ STATIC uint8 Port_Status = PORT_NOT_INITIALIZED;
 * Parameters (out): None
 * Return value: None
 * Description: Initializes the Port Driver module. 
+*              The pins configuration is first reduced into one register image per port
+*              (or the images precomputed by the configuration generator are used),
+*              then each port clock is enabled once and each port register is written once.
 ************************************************************************************/
 void Port_Init(const Port_ConfigType * ConfigPtr )
 {
     volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-    volatile uint32 delay = 0;
+    const Port_RegImageType * Images_Ptr = NULL_PTR; /* register images of all the ports */
+    const Port_RegImageType * Port_Image_Ptr = NULL_PTR;
+    uint32 Pctl_Mask = 0;
+    uint8 Ports_Mask = 0; /* clock gating mask of the used ports */
+    Port_ShadowRegType * Shadow_Ptr = NULL_PTR; /* register values written on the current port */
+#if (PORT_SHADOW_REGISTERS == STD_OFF)
+    Port_ShadowRegType Port_Regs;
+#endif
+#if (PORT_PRECOMPUTED_REG_IMAGES == STD_OFF)
+    Port_RegImageType Port_Images[PORT_NUMBER_OF_PORTS] = {0}; /* register image of each port */
+    Port_RegImageType * Image_Ptr = NULL_PTR;
+    uint8 Pin_Mask = 0;
+    uint8 Pmc = 0;
+#endif
     
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 	/* check if the input configuration pointer is not a NULL_PTR */
@@ -54,42 +157,56 @@ void Port_Init(const Port_ConfigType * ConfigPtr )
         {
           Port_Pins = ConfigPtr->Pins;          /* points to address of the first pins structure --> Pins[0] */
           uint8 Pin_Count = 0;  /* count to configure each port pin */
+          uint8 Port_Count = 0; /* count to write each port */
          
+          for(Port_Count = 0 ; Port_Count < PORT_NUMBER_OF_PORTS ; Port_Count++)
+          {
+            Port_DirRefreshMask[Port_Count] = 0;
+            Port_DirShadow[Port_Count] = 0;
+          }
+          
+          /* Resolve the port registers base address of each pin once and the expected direction of each port */
           for(Pin_Count = 0 ; Pin_Count < PORT_NUMBER_OF_PORT_PINS ; Pin_Count++)
           {
-            /* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-            switch(Port_Pins[Pin_Count].Port_Num)
+            Port_PinBaseAddress[Pin_Count] = (volatile uint32 *)Port_PortBaseAddress[Port_Pins[Pin_Count].Port_Num];
+            
+            /* Pins with direction changeable during run time and the JTAG pins PC0 to PC3 are not refreshed */
+            if( (STD_OFF == Port_Pins[Pin_Count].Port_Pin_Direction_Changeable)
+             && !((Port_Pins[Pin_Count].Port_Num == PORT_C) && (Port_Pins[Pin_Count].Pin_Num <= PIN_3)) )
+            {
+              SET_BIT(Port_DirRefreshMask[Port_Pins[Pin_Count].Port_Num], Port_Pins[Pin_Count].Pin_Num);
+              if(Port_Pins[Pin_Count].Port_Pin_Direction == PORT_PIN_OUT)
+              {
+                SET_BIT(Port_DirShadow[Port_Pins[Pin_Count].Port_Num], Port_Pins[Pin_Count].Pin_Num);
+              }
+              else
+              {
+                /* No Action Required ... input pin */
+              }
+            }
+            else
             {
-                case  PORT_A: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-                        break;
-                case  PORT_B: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-                        break;
-                case  PORT_C: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-                        break;
-                case  PORT_D: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-                        break;
-                case  PORT_E: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-                        break;
-                case  PORT_F: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-                        break;
-                        
-                default: break;
+              /* No Action Required */
             }
+          }
+          
+#if (PORT_PRECOMPUTED_REG_IMAGES == STD_ON)
+          /* The register image of each port is precomputed in the PB configuration */
+          Images_Ptr = ConfigPtr->Ports;
+#else
+          /* Reduce the configuration of all the pins into one register image per port */
+          for(Pin_Count = 0 ; Pin_Count < PORT_NUMBER_OF_PORT_PINS ; Pin_Count++)
+          {
+            Image_Ptr = &Port_Images[Port_Pins[Pin_Count].Port_Num];
+            Pin_Mask  = (uint8)(1U << Port_Pins[Pin_Count].Pin_Num);
             
-            /* Enable clock for PORT and allow time for clock to start*/
-            SET_BIT(SYSCTL_REGCGC2_REG, Port_Pins[Pin_Count].Port_Num);
-            delay = SYSCTL_REGCGC2_REG;
+            Image_Ptr->Pins_Mask |= Pin_Mask;
             
-            /* Unlock port pins for use, enable commit to write on pins and Secure the JTAG pins */
+            /* PD7 and PF0 are locked, they need to be unlocked and committed before being configured */
             if( ((Port_Pins[Pin_Count].Port_Num == PORT_D) && (Port_Pins[Pin_Count].Pin_Num == PIN_7)) || 
                ((Port_Pins[Pin_Count].Port_Num == PORT_F) && (Port_Pins[Pin_Count].Pin_Num == PIN_0)) ) /* PD7 or PF0 */
             {
-                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;                     /* Unlock the GPIOCR register */   
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);  /* Set the corresponding bit in GPIOCR register to allow changes on this pin */
-            }
-            else if( (Port_Pins[Pin_Count].Port_Num == PORT_C) && (Port_Pins[Pin_Count].Pin_Num <= PIN_3) ) /* PC0 to PC3 */
-            {
-                /* Do Nothing ...  this is the JTAG pins */
+                Image_Ptr->Commit |= Pin_Mask;
             }
             else
             {
@@ -99,49 +216,49 @@ void Port_Init(const Port_ConfigType * ConfigPtr )
             /* Check for port pin Direction, Internal Resistor and set Pin level Initial Value */
             if(Port_Pins[Pin_Count].Port_Pin_Direction == PORT_PIN_OUT)
             {
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);                /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
+                Image_Ptr->Dir |= Pin_Mask;
                 
                 if(Port_Pins[Pin_Count].Port_Pin_Level_Value == STD_HIGH)
                 {
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);          /* Set the corresponding bit in the GPIODATA register to provide initial value 1 */
+                    Image_Ptr->Data |= Pin_Mask;
                 }
                 else
                 {
-                    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);        /* Clear the corresponding bit in the GPIODATA register to provide initial value 0 */
+                    /* Do Nothing ... initial value 0 */
                 }
                 
                 #if (PORT_OPTIONAL_CONFIG == STD_ON)
                 /* Check for port pin Open Drain Mode */
                 if(Port_Pins[Pin_Count].Pin_Driven_Mode == STD_ON)
                 {
-                   SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_OPEN_DRAIN_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);       /* Set the corresponding bit in the GPIOODR register to enable the open-drain mode pin */
+                   Image_Ptr->Odr |= Pin_Mask;
                 }
                 else
                 {
-                   CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_OPEN_DRAIN_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIOODR register to disable the open-drain mode pin */
+                   /* Do Nothing ... open-drain mode disabled */
                 }
                 
                 /* Check for port pin Output Current */
                 if(Port_Pins[Pin_Count].Pin_Current == R2R)
                 { 
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DR2R_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);              /* Set the corresponding bit in the GPIODR2R register to have 2mA drive */ 
+                  Image_Ptr->Dr2r |= Pin_Mask;
                 }
                 else if(Port_Pins[Pin_Count].Pin_Current == R4R)
                 { 
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DR4R_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);              /* Set the corresponding bit in the GPIODR2R register to have 4mA drive */ 
+                  Image_Ptr->Dr4r |= Pin_Mask;
                 }
                 else if(Port_Pins[Pin_Count].Pin_Current == R8R)
                 { 
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DR8R_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);              /* Set the corresponding bit in the GPIODR2R register to have 8mA drive */ 
+                  Image_Ptr->Dr8r |= Pin_Mask;
                   
                   /* Control the Pin slew rate when using the 8-mA drive strength option */
                   if(Port_Pins[Pin_Count].Pin_Slew_Rate == STD_ACTIVE)
                   {
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_SLEW_RATE_CTL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);            /* Set the corresponding bit in the GPIOSLR register to enable slew rate control */ 
+                    Image_Ptr->Slr |= Pin_Mask;
                   }
                   else
                   {
-                    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_SLEW_RATE_CTL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);            /* Set the corresponding bit in the GPIOSLR register to disable slew rate control */ 
+                    /* Do Nothing ... slew rate control disabled */
                   }
                 }
                 else
@@ -152,23 +269,42 @@ void Port_Init(const Port_ConfigType * ConfigPtr )
             }
             else if(Port_Pins[Pin_Count].Port_Pin_Direction == PORT_PIN_IN)
             {
-                
-                CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);             /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-                
                 if(Port_Pins[Pin_Count].Port_Pin_Resistor == PULL_UP)
                 {
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);       /* Set the corresponding bit in the GPIOPUR register to enable the internal pull up pin */
+                    Image_Ptr->Pur |= Pin_Mask;
                 }
                 else if(Port_Pins[Pin_Count].Port_Pin_Resistor == PULL_DOWN)
                 {
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Set the corresponding bit in the GPIOPDR register to enable the internal pull down pin */
+                    Image_Ptr->Pdr |= Pin_Mask;
                 }
                 else
                 {
-                    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIOPUR register to disable the internal pull up pin */
-                    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);   /* Clear the corresponding bit in the GPIOPDR register to disable the internal pull down pin */
+                    /* Do Nothing ... internal resistors disabled */
                 }
                 
+                #if (PORT_EDGE_INTERRUPTS == STD_ON)
+                /* Check for port pin edge interrupt */
+                if(Port_Pins[Pin_Count].Port_Pin_Edge != PORT_PIN_EDGE_NONE)
+                {
+                    Image_Ptr->Im |= Pin_Mask;
+                    if(Port_Pins[Pin_Count].Port_Pin_Edge == PORT_PIN_EDGE_BOTH)
+                    {
+                        Image_Ptr->Ibe |= Pin_Mask;
+                    }
+                    else if(Port_Pins[Pin_Count].Port_Pin_Edge == PORT_PIN_EDGE_RISING)
+                    {
+                        Image_Ptr->Iev |= Pin_Mask;
+                    }
+                    else
+                    {
+                        /* Do Nothing ... falling edge */
+                    }
+                }
+                else
+                {
+                    /* Do Nothing ... no edge interrupt */
+                }
+                #endif
             }
             else
             {
@@ -176,251 +312,163 @@ void Port_Init(const Port_ConfigType * ConfigPtr )
             }
             
             /* Check for port pin Mode */
-            switch(Port_Pins[Pin_Count].Port_Pin_Mode)
+            if( (Port_Pins[Pin_Count].Port_Num == PORT_C) && (Port_Pins[Pin_Count].Pin_Num <= PIN_3) ) /* PC0 to PC3 */
             {
-              case PORT_PIN_MODE_DIO:
-              {
-                if( (Port_Pins[Pin_Count].Port_Num == PORT_C) && (Port_Pins[Pin_Count].Pin_Num <= PIN_3) ) /* PC0 to PC3 */
-                {
-                  /* Do Nothing ...  this is the JTAG pins */
-                }
-                else
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);      /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);             /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_Pins[Pin_Count].Pin_Num * 4));     /* Clear the PMCx bits for this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);         /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */   
-                }
-                
-                break;
-              }
-              case PORT_PIN_MODE_ADC:
-              {
-                if( Port_Pins[Pin_Count].Port_Pin_Direction == PORT_PIN_IN &&
-                  ( Pin_Count == PORT_B_PIN_4 || Pin_Count == PORT_B_PIN_5 || (Pin_Count >= PORT_D_PIN_0 && Pin_Count <= PORT_D_PIN_3) 
-                 || (Pin_Count >= PORT_E_PIN_0 && Pin_Count <= PORT_E_PIN_5) )  )
-                {
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);             /* Enable Alternative function for this pin by setting the corresponding bit in GPIOAFSEL register */
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);      /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-                }
-                else
-                {}
-                
-                break;
-              }
-              case PORT_PIN_MODE_UART:          /* UART 1 RTS, CTS with PC4, PC5 is not handled. */
-              {
-                if( Pin_Count == PORT_A_PIN_0 || Pin_Count == PORT_A_PIN_1 || Pin_Count == PORT_B_PIN_0 || Pin_Count == PORT_B_PIN_1 
-                 || Pin_Count == PORT_C_PIN_4 || Pin_Count == PORT_C_PIN_5 || Pin_Count == PORT_C_PIN_6 || Pin_Count == PORT_C_PIN_7 
-                 || Pin_Count == PORT_D_PIN_4 || Pin_Count == PORT_D_PIN_5 || Pin_Count == PORT_D_PIN_6 || Pin_Count == PORT_D_PIN_7
-                 || Pin_Count == PORT_E_PIN_0 || Pin_Count == PORT_E_PIN_1 || Pin_Count == PORT_E_PIN_4 || Pin_Count == PORT_E_PIN_5 
-                 || Pin_Count == PORT_F_PIN_0 || Pin_Count == PORT_F_PIN_1 )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000001 << (Port_Pins[Pin_Count].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else
-                {}
-                
-                /* Check if PB0 and PB1 pins are not used as UART 1, so set PC4 and PC5 on UART 1 (Port Mode = 2) instead of UART 4 (Port Mode = 1) */
-                if( ( Pin_Count == PORT_C_PIN_4 && !(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) & (0x0000000F<<(Port_Pins[PORT_B_PIN_0].Pin_Num * 4)) ) ) 
-                 || ( Pin_Count == PORT_C_PIN_5 && !(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) & (0x0000000F<<(Port_Pins[PORT_B_PIN_1].Pin_Num * 4)) ) ) )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000002 << (Port_Pins[Pin_Count].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else
-                {}
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                
-                break;
-              }
-              case PORT_PIN_MODE_SSI:           /* SSI 1 with PD0 -> PD03 is not handled. */
-              {
-                if( (Pin_Count >= PORT_A_PIN_2 && Pin_Count <= PORT_A_PIN_5)
-                 || (Pin_Count >= PORT_B_PIN_4 && Pin_Count <= PORT_B_PIN_7) 
-                 || (Pin_Count >= PORT_F_PIN_0 && Pin_Count <= PORT_F_PIN_3) )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000002 << (Port_Pins[Pin_Count].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else if(Pin_Count == PORT_D_PIN_0 || Pin_Count == PORT_D_PIN_1 || Pin_Count == PORT_D_PIN_2 || Pin_Count == PORT_D_PIN_3 )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000001 << (Port_Pins[Pin_Count].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else
-                {}
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
+                /* Do Nothing ...  this is the JTAG pins */
+            }
+            else
+            {
+                Image_Ptr->Mode_Mask |= Pin_Mask;
+                Pmc = Port_GetPinModePmc(Pin_Count, Port_Pins[Pin_Count].Port_Pin_Mode);
                 
-                break;
-              }
-              case PORT_PIN_MODE_I2C:
-              {
-                if( Pin_Count == PORT_A_PIN_6 || Pin_Count == PORT_A_PIN_7 || Pin_Count == PORT_B_PIN_2 || Pin_Count == PORT_B_PIN_3
-                 || Pin_Count == PORT_D_PIN_0 || Pin_Count == PORT_D_PIN_1 || Pin_Count == PORT_E_PIN_4 || Pin_Count == PORT_E_PIN_5 )
+                /* The ADC inputs can only be used with input pins */
+                if( (PORT_PIN_MODE_ID(Port_Pins[Pin_Count].Port_Pin_Mode) == PORT_PIN_MODE_ADC) && (Port_Pins[Pin_Count].Port_Pin_Direction != PORT_PIN_IN) )
                 {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000003 << (Port_Pins[Pin_Count].Pin_Num * 4));     /* Set the PMCx bits for this pin */
+                    Pmc = PORT_PMC_ILLEGAL;
                 }
                 else
-                {}
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                
-                break;
-              }
-              case PORT_PIN_MODE_CAN:
-              {
-                if( Pin_Count == PORT_A_PIN_0 || Pin_Count == PORT_A_PIN_1 || Pin_Count == PORT_B_PIN_4 || Pin_Count == PORT_B_PIN_5
-                 || Pin_Count == PORT_E_PIN_4 || Pin_Count == PORT_E_PIN_5 )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000008 << (Port_Pins[Pin_Count].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else if( Pin_Count == PORT_F_PIN_0 || Pin_Count == PORT_F_PIN_3 )
                 {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000003 << (Port_Pins[Pin_Count].Pin_Num * 4));     /* Set the PMCx bits for this pin */
+                    /* No Action Required */
                 }
-                else
-                {}
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
                 
-                break;
-              }
-              case PORT_PIN_MODE_USB:
-              {
-                if( Pin_Count == PORT_B_PIN_0 || Pin_Count == PORT_B_PIN_1 || Pin_Count == PORT_D_PIN_4 || Pin_Count == PORT_D_PIN_5 )
+                if(Pmc == PORT_PMC_ANALOG)
                 {
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);             /* Enable Alternative function for this pin by setting the corresponding bit in GPIOAFSEL register */
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);      /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
+                    Image_Ptr->Afsel |= Pin_Mask;  /* Alternative function with the digital functionality disabled */
+                    Image_Ptr->Amsel |= Pin_Mask;  /* Analog functionality enabled */
                 }
-                else if( Pin_Count == PORT_C_PIN_6 || Pin_Count == PORT_C_PIN_7 || Pin_Count == PORT_D_PIN_2 || Pin_Count == PORT_D_PIN_3
-                      || Pin_Count == PORT_F_PIN_4 )
+                else if(Pmc == PORT_PMC_ILLEGAL)
                 {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000008 << (Port_Pins[Pin_Count].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
+                    Image_Ptr->Den |= Pin_Mask;    /* Mode not available on this pin ... keep it as a digital GPIO */
                 }
                 else
-                {}
-                
-                break;
-              }
-              case PORT_PIN_MODE_GPT:
-              {
-                if( !(Pin_Count <= PORT_A_PIN_7) || !(Pin_Count >= PORT_E_PIN_0 && Pin_Count <= PORT_E_PIN_5)  )
                 {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000007 << (Port_Pins[Pin_Count].Pin_Num * 4));     /* Set the PMCx bits for this pin */
+                    Image_Ptr->Den |= Pin_Mask;    /* Digital functionality enabled */
+                    if(Pmc != PORT_PMC_GPIO)
+                    {
+                        Image_Ptr->Afsel |= Pin_Mask;
+                        Image_Ptr->Pctl  |= ((uint32)Pmc << (Port_Pins[Pin_Count].Pin_Num * 4));
+                    }
+                    else
+                    {
+                        /* Do Nothing ... GPIO uses no alternative function */
+                    }
                 }
-                else
-                {}
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                
-                break;
-              }
-               case PORT_PIN_MODE_PWM:          /* M1PWM with PD0, PD1, PE4, PE5, PF2 is not handled. */
+            }
+          }     /* for(Pin_Count = 0 ; Pin_Count < PORT_NUMBER_OF_PORT_PINS ; Pin_Count++) */
+          Images_Ptr = Port_Images;
+#endif
+          
+          /* Clock gating mask of the ports which have configured pins */
+          for(Port_Count = 0 ; Port_Count < PORT_NUMBER_OF_PORTS ; Port_Count++)
+          {
+            if(Images_Ptr[Port_Count].Pins_Mask != 0)
+            {
+                Ports_Mask |= (uint8)(1U << Port_Count);
+            }
+          }
+          
+          /* Enable clock for all the used PORTs at once and allow time for clock to start */
+          SYSCTL_REGCGC2_REG |= Ports_Mask;
+          (void)SYSCTL_REGCGC2_REG;
+          
+#if (PORT_GPIO_AHB_APERTURE == STD_ON)
+          /* Move all the used PORTs to the AHB aperture, their registers are only accessible through the AHB base addresses from now on */
+          SYSCTL_GPIOHBCTL_REG |= Ports_Mask;
+#endif
+          
+          /* Write the register image of each used port, each register is written once */
+          for(Port_Count = 0 ; Port_Count < PORT_NUMBER_OF_PORTS ; Port_Count++)
+          {
+            Port_Image_Ptr = &Images_Ptr[Port_Count];
+            if(Port_Image_Ptr->Pins_Mask != 0)
+            {
+              /* Point to the correct PORT register according to the Port Id */
+              PortGpio_Ptr = (volatile uint32 *)Port_PortBaseAddress[Port_Count];
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+              Shadow_Ptr = &Port_Shadow[Port_Count];    /* the written values are kept as the port shadow */
+#else
+              Shadow_Ptr = &Port_Regs;
+#endif
+            
+              /* Unlock port pins for use, enable commit to write on pins and Secure the JTAG pins */
+              if(Port_Image_Ptr->Commit != 0)
               {
-                if( (Pin_Count >= PORT_B_PIN_4 && Pin_Count <= PORT_B_PIN_7) || Pin_Count == PORT_C_PIN_4 || Pin_Count == PORT_C_PIN_5
-                 || Pin_Count == PORT_D_PIN_0 || Pin_Count == PORT_D_PIN_1 || Pin_Count == PORT_D_PIN_2 || Pin_Count == PORT_D_PIN_6 
-                 || Pin_Count == PORT_E_PIN_4 || Pin_Count == PORT_E_PIN_5 || Pin_Count == PORT_F_PIN_2 )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000004 << (Port_Pins[Pin_Count].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else if( Pin_Count == PORT_A_PIN_6 || Pin_Count == PORT_A_PIN_7
-                      || Pin_Count == PORT_F_PIN_0 || Pin_Count == PORT_F_PIN_1 || Pin_Count == PORT_F_PIN_3 || Pin_Count == PORT_F_PIN_4 )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000005 << (Port_Pins[Pin_Count].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else
-                {}
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                
-                break;
+                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;                     /* Unlock the GPIOCR register */   
+                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET) |= Port_Image_Ptr->Commit;          /* Set the corresponding bits in GPIOCR register to allow changes on these pins */
               }
-              case PORT_PIN_MODE_QEI:
+              else
               {
-                if( (Pin_Count >= PORT_C_PIN_4 && Pin_Count <= PORT_C_PIN_6) || Pin_Count == PORT_D_PIN_3 || Pin_Count == PORT_D_PIN_6
-                 || Pin_Count == PORT_D_PIN_7 || Pin_Count == PORT_F_PIN_0 || Pin_Count == PORT_F_PIN_1 || Pin_Count == PORT_F_PIN_4 )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000006 << (Port_Pins[Pin_Count].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else
-                {}
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                
-                break;
+                  /* Do Nothing ... No need to unlock the commit register for this port */
               }
-              case PORT_PIN_MODE_ANALOG_COMP:
+            
+              /* Direction and initial level, the initial level is written through the GPIODATA mask alias of the configured pins */
+              Shadow_Ptr->Dir = (uint8)((*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) & ~(uint32)Port_Image_Ptr->Pins_Mask) | Port_Image_Ptr->Dir);
+              *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) = Shadow_Ptr->Dir;
+              *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + ((uint32)(Port_Image_Ptr->Pins_Mask & Port_Image_Ptr->Dir) << 2)) = Port_Image_Ptr->Data;
+            
+              #if (PORT_OPTIONAL_CONFIG == STD_ON)
+              /* Open drain, output current and slew rate of the output pins */
+              *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_OPEN_DRAIN_REG_OFFSET) = 
+                (*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_OPEN_DRAIN_REG_OFFSET) & ~(uint32)Port_Image_Ptr->Dir) | Port_Image_Ptr->Odr;
+              *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DR2R_REG_OFFSET) |= Port_Image_Ptr->Dr2r;
+              *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DR4R_REG_OFFSET) |= Port_Image_Ptr->Dr4r;
+              *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DR8R_REG_OFFSET) |= Port_Image_Ptr->Dr8r;
+              *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_SLEW_RATE_CTL_REG_OFFSET) = 
+                (*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_SLEW_RATE_CTL_REG_OFFSET) & ~(uint32)Port_Image_Ptr->Dr8r) | Port_Image_Ptr->Slr;
+              #endif
+            
+              /* Internal resistors of the input pins */
+              *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) = 
+                (*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) & ~(uint32)Port_Image_Ptr->Pins_Mask) | Port_Image_Ptr->Pur;
+              *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) = 
+                (*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) & ~(uint32)Port_Image_Ptr->Pins_Mask) | Port_Image_Ptr->Pdr;
+            
+              /* Pin modes, the JTAG pins are excluded from the Mode_Mask */
+              Pctl_Mask = 0;
+              for(Pin_Count = 0 ; Pin_Count < 8 ; Pin_Count++)
               {
-                if( Pin_Count >= PORT_C_PIN_4 && Pin_Count <= PORT_C_PIN_7 )
-                {
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);             /* Enable Alternative function for this pin by setting the corresponding bit in GPIOAFSEL register */
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);      /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-                }
-                else if( Pin_Count == PORT_F_PIN_0 || Pin_Count == PORT_F_PIN_1 )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000009 << (Port_Pins[Pin_Count].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                }
-                else
-                {}
-                
-                break;
+                  if(BIT_IS_SET(Port_Image_Ptr->Mode_Mask, Pin_Count))
+                  {
+                      Pctl_Mask |= (0x0000000FUL << (Pin_Count * 4));
+                  }
               }
-              case PORT_PIN_MODE_NMI:
+              Shadow_Ptr->Amsel = (uint8)((*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) & ~(uint32)Port_Image_Ptr->Mode_Mask) | Port_Image_Ptr->Amsel);
+              *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) = Shadow_Ptr->Amsel;
+              Shadow_Ptr->Afsel = (uint8)((*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) & ~(uint32)Port_Image_Ptr->Mode_Mask) | Port_Image_Ptr->Afsel);
+              *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) = Shadow_Ptr->Afsel;
+              Shadow_Ptr->Pctl = (*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) & ~Pctl_Mask) | Port_Image_Ptr->Pctl;
+              *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) = Shadow_Ptr->Pctl;
+              Shadow_Ptr->Den = (uint8)((*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) & ~(uint32)Port_Image_Ptr->Mode_Mask) | Port_Image_Ptr->Den);
+              *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) = Shadow_Ptr->Den;
+            
+              #if (PORT_EDGE_INTERRUPTS == STD_ON)
+              /* Edge interrupts of the input pins, masked while their sense is set and the edges detected meanwhile cleared before unmasking */
+              if(Port_Image_Ptr->Im != 0)
               {
-                if( Pin_Count == PORT_D_PIN_7 || Pin_Count == PORT_F_PIN_0 )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000008 << (Port_Pins[Pin_Count].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else
-                {}
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                
-                break;
+                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_INT_MASK_REG_OFFSET) &= ~(uint32)Port_Image_Ptr->Pins_Mask;
+                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_INT_SENSE_REG_OFFSET) &= ~(uint32)Port_Image_Ptr->Im;
+                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_INT_BOTH_EDGES_REG_OFFSET) = 
+                    (*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_INT_BOTH_EDGES_REG_OFFSET) & ~(uint32)Port_Image_Ptr->Pins_Mask) | Port_Image_Ptr->Ibe;
+                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_INT_EVENT_REG_OFFSET) = 
+                    (*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_INT_EVENT_REG_OFFSET) & ~(uint32)Port_Image_Ptr->Pins_Mask) | Port_Image_Ptr->Iev;
+                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_INT_CLEAR_REG_OFFSET) = Port_Image_Ptr->Im;
+                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_INT_MASK_REG_OFFSET) |= Port_Image_Ptr->Im;
+                  NVIC_PRI_REG(Port_PortIrqNumber[Port_Count]) =
+                    (NVIC_PRI_REG(Port_PortIrqNumber[Port_Count]) & ~(NVIC_PRI_MASK << NVIC_PRI_BITS_POS(Port_PortIrqNumber[Port_Count])))
+                    | ((uint32)PORT_EDGE_INTERRUPT_PRIORITY << NVIC_PRI_BITS_POS(Port_PortIrqNumber[Port_Count]));
+                  NVIC_EN0_REG = (1UL << Port_PortIrqNumber[Port_Count]);    /* writing 0 to the other bits has no effect */
               }
-              case PORT_PIN_MODE_TRACE:
+              else
               {
-                if( Pin_Count >= PORT_F_PIN_1 && Pin_Count <= PORT_F_PIN_3 )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x0000000E << (Port_Pins[Pin_Count].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else
-                {}
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                
-                break;
+                  /* Do Nothing ... No edge interrupt on this port */
               }
-              
-              default: break;
+              #endif
+            }
+            else
+            {
+                /* Do Nothing ... No configured pins on this port */
             }
-          }     /* for(Pin_Count = 0 ; Pin_Count<=PORT_NUMBER_OF_PORT_PINS ; Pin_Count++) */
+          }
         
           Port_Status = PORT_INITIALIZED;
         }
@@ -483,25 +531,25 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
         /* In-case there are no errors */
 	if(FALSE == error)
 	{
-            /* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-            switch(Port_Pins[Pin].Port_Num)
+            /* Point to the PORT registers of this pin cached by Port_Init */
+            PortGpio_Ptr = Port_PinBaseAddress[Pin];
+            
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+            /* Update the direction in the port shadow and write the whole register from it, GPIODIR is not read */
+            if(Direction == PORT_PIN_OUT)
             {
-                case  PORT_A: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-                        break;
-                case  PORT_B: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-                        break;
-                case  PORT_C: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-                        break;
-                case  PORT_D: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-                        break;
-                case  PORT_E: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-                        break;
-                case  PORT_F: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-                        break;
-                        
-                default: break;
+                SET_BIT(Port_Shadow[Port_Pins[Pin].Port_Num].Dir, Port_Pins[Pin].Pin_Num);
             }
-            
+            else if(Direction == PORT_PIN_IN)
+            {
+                CLEAR_BIT(Port_Shadow[Port_Pins[Pin].Port_Num].Dir, Port_Pins[Pin].Pin_Num);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+            *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) = Port_Shadow[Port_Pins[Pin].Port_Num].Dir;
+#else
             if(Direction == PORT_PIN_OUT)
             {
                 SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET), Port_Pins[Pin].Pin_Num);                /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
@@ -516,6 +564,7 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
             {
                 /* Do Nothing */
             }
+#endif
             
         }
         else
@@ -536,14 +585,16 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
 * Parameters (out): None
 * Return value: None
 * Description: Refreshes port direction.
+*              Each port is read once and compared with the expected direction of its
+*              refreshed pins, the GPIODIR register is only rewritten if the port has drifted.
 ************************************************************************************/
 void Port_RefreshPortDirection(void)
 {
   volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
   boolean error =  FALSE;
+  uint32 Dir = 0;
   
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
-        /* Check if the Driver is initialized before using this function */
 	/* Check if the Driver is initialized before using this function */
 	if (PORT_NOT_INITIALIZED == Port_Status)
 	{
@@ -560,50 +611,34 @@ void Port_RefreshPortDirection(void)
         /* In-case there are no errors */
 	if(FALSE == error)
 	{
-          for(uint8 Pin_Count = 0 ; Pin_Count < PORT_NUMBER_OF_PORT_PINS ; Pin_Count++)
+          for(uint8 Port_Count = 0 ; Port_Count < PORT_NUMBER_OF_PORTS ; Port_Count++)
           {
-            /* Exclude the port pins from refreshing that are configured as pin direction changeable during runtime. */ 
-            if(STD_OFF == Port_Pins[Pin_Count].Port_Pin_Direction_Changeable)
+            /* Exclude the ports without pins to refresh, pins with direction changeable during runtime are masked out */
+            if(Port_DirRefreshMask[Port_Count] != 0)
             {
-              /* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-              switch(Port_Pins[Pin_Count].Port_Num)
-              {
-                  case  PORT_A: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-                          break;
-                  case  PORT_B: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-                          break;
-                  case  PORT_C: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-                          break;
-                  case  PORT_D: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-                          break;
-                  case  PORT_E: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-                          break;
-                  case  PORT_F: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-                          break;
-                          
-                  default: break;
-              }
+              PortGpio_Ptr = (volatile uint32 *)Port_PortBaseAddress[Port_Count];
               
-              /* Read port pin direction and write it on the same pin */
-              if( BIT_IS_SET(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num) )
-              {
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num); 
-              }
-              else if( BIT_IS_CLEAR(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num) )
+              /* Read the port direction once and only write it back if a refreshed pin has drifted */
+              Dir = *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET);
+              if( ((Dir ^ Port_DirShadow[Port_Count]) & Port_DirRefreshMask[Port_Count]) != 0 )
               {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_Pins[Pin_Count].Pin_Num); 
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) = Port_Shadow[Port_Count].Dir;
+#else
+                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) = 
+                    (Dir & ~(uint32)Port_DirRefreshMask[Port_Count]) | Port_DirShadow[Port_Count];
+#endif
+                  Port_DirDriftCount++;
               }
-              else 
+              else
               {
-                /* Do Nothing */
+                /* Do Nothing ... direction as expected */
               }
-            
             }
             else
             {
               /* Do Not Refresh */
             }
-    
           }
         }
         else
@@ -612,6 +647,22 @@ void Port_RefreshPortDirection(void)
 	}
 }
 
+/************************************************************************************
+* Service Name: Port_GetDirectionDriftCount
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of drifted ports detected by Port_RefreshPortDirection.
+* Description: Returns the number of times Port_RefreshPortDirection found a port
+*              whose direction differed from its configuration and restored it.
+************************************************************************************/
+uint32 Port_GetDirectionDriftCount(void)
+{
+    return Port_DirDriftCount;
+}
+
 /************************************************************************************
 * Service Name: Port_GetVersionInfo
 * Service ID[hex]: 0x03
@@ -663,11 +714,15 @@ void Port_GetVersionInfo(Std_VersionInfoType *versioninfo)
 * Return value: None
 * Description: Sets the port pin mode.
 ************************************************************************************/
-#if (PORT_SET_PIN_MOPDE_API == STD_ON)
+#if (PORT_SET_PIN_MODE_API == STD_ON)
 void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
 {
     volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
     boolean error = FALSE;
+    uint8 Pmc = PORT_PMC_ILLEGAL;
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+    Port_ShadowRegType * Shadow_Ptr = NULL_PTR;
+#endif
     
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
         /* Check if the Driver is initialized before using this function */
@@ -692,8 +747,8 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
 	{
           /* No Action Required */
 	}
-        /* Check if the used mode is within the valid range */
-	if (PORT_NUMBER_OF_PORT_PIN_MODES <= Mode && FALSE == error)
+        /* Check if the used mode is valid and available on this pin */
+	if (FALSE == error && PORT_PMC_ILLEGAL == Port_GetPinModePmc(Pin, Mode))
 	{
 		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID,
 		PORT_E_PARAM_INVALID_MODE);
@@ -704,7 +759,7 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
           /* No Action Required */
 	}
         /* Check if the used pin's mode is changeable during run time */
-        if(STD_OFF == Port_Pins[Pin].Port_Pin_Mode_Changeable && FALSE == error)
+        if(FALSE == error && STD_OFF == Port_Pins[Pin].Port_Pin_Mode_Changeable)
         {
           	Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID,
 			PORT_E_MODE_UNCHANGEABLE);
@@ -715,274 +770,163 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
           /* No Action Required */
         }
 #endif
-        uint8 Pin_Count = 0;  /* count to configure each port pin */
         
         /* In-case there are no errors */
 	if(FALSE == error)
 	{
-            /* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-            switch(Port_Pins[Pin].Port_Num)
+            /* Point to the PORT registers of this pin cached by Port_Init */
+            PortGpio_Ptr = Port_PinBaseAddress[Pin];
+            
+            /* Pin mux of the mode on this pin from the pin mux table */
+            Pmc = Port_GetPinModePmc(Pin, Mode);
+            
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+            /* Update the mode registers in the port shadow and write each whole register from it, no register is read */
+            Shadow_Ptr = &Port_Shadow[Port_Pins[Pin].Port_Num];
+            if(Pmc == PORT_PMC_ANALOG)
             {
-                case  PORT_A: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-                        break;
-                case  PORT_B: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-                        break;
-                case  PORT_C: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-                        break;
-                case  PORT_D: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-                        break;
-                case  PORT_E: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-                        break;
-                case  PORT_F: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-                        break;
-                        
-                default: break;
+                CLEAR_BIT(Shadow_Ptr->Den, Port_Pins[Pin].Pin_Num);
+                SET_BIT(Shadow_Ptr->Afsel, Port_Pins[Pin].Pin_Num);
+                Shadow_Ptr->Pctl &= ~(0x0000000FUL << (Port_Pins[Pin].Pin_Num * 4));
+                SET_BIT(Shadow_Ptr->Amsel, Port_Pins[Pin].Pin_Num);
+                
+                /* Digital functionality is disabled before the analog functionality is enabled */
+                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) = Shadow_Ptr->Den;
+                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) = Shadow_Ptr->Afsel;
+                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) = Shadow_Ptr->Pctl;
+                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) = Shadow_Ptr->Amsel;
             }
-            
-            /* Check for port pin Mode */
-            switch(Mode)
+            else if(Pmc != PORT_PMC_ILLEGAL)
             {
-              case PORT_PIN_MODE_DIO:
-              {
-                CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);      /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);             /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_Pins[Pin].Pin_Num * 4));     /* Clear the PMCx bits for this pin */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin].Pin_Num);         /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                
-                break;
-              }
-              case PORT_PIN_MODE_ADC:
-              {
-                if( Pin_Count == PORT_B_PIN_4 || Pin_Count == PORT_B_PIN_5 || (Pin_Count >= PORT_D_PIN_0 && Pin_Count <= PORT_D_PIN_3) 
-                 || (Pin_Count >= PORT_E_PIN_0 && Pin_Count <= PORT_E_PIN_5) )
-                {
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);             /* Enable Alternative function for this pin by setting the corresponding bit in GPIOAFSEL register */
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);      /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-                }
-                else
-                {}
-                
-                break;
-              }
-              case PORT_PIN_MODE_UART:          /* UART 1 RTS, CTS with PC4, PC5 is not handled. */
-              {
-                if( Pin_Count == PORT_A_PIN_0 || Pin_Count == PORT_A_PIN_1 || Pin_Count == PORT_B_PIN_0 || Pin_Count == PORT_B_PIN_1 
-                 || Pin_Count == PORT_C_PIN_4 || Pin_Count == PORT_C_PIN_5 || Pin_Count == PORT_C_PIN_6 || Pin_Count == PORT_C_PIN_7 
-                 || Pin_Count == PORT_D_PIN_4 || Pin_Count == PORT_D_PIN_5 || Pin_Count == PORT_D_PIN_6 || Pin_Count == PORT_D_PIN_7
-                 || Pin_Count == PORT_E_PIN_0 || Pin_Count == PORT_E_PIN_1 || Pin_Count == PORT_E_PIN_4 || Pin_Count == PORT_E_PIN_5 
-                 || Pin_Count == PORT_F_PIN_0 || Pin_Count == PORT_F_PIN_1 )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000001 << (Port_Pins[Pin].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else
-                {}
-                
-                /* Check if PB0 and PB1 pins are not used as UART 1, so set PC4 and PC5 on UART 1 (Port Mode = 2) instead of UART 4 (Port Mode = 1) */
-                if( ( Pin_Count == PORT_C_PIN_4 && !(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) & (0x0000000F<<(Port_Pins[PORT_B_PIN_0].Pin_Num * 4))) ) 
-                 || ( Pin_Count == PORT_C_PIN_5 && !(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) & (0x0000000F<<(Port_Pins[PORT_B_PIN_1].Pin_Num * 4))) ) )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000002 << (Port_Pins[Pin].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else
-                {}
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                
-                break;
-              }
-              case PORT_PIN_MODE_SSI:           /* SSI 1 with PD0 -> PD03 is not handled. */
-              {
-                if( (Pin_Count >= PORT_A_PIN_2 && Pin_Count <= PORT_A_PIN_5)
-                 || (Pin_Count >= PORT_B_PIN_4 && Pin_Count <= PORT_B_PIN_7) 
-                 || (Pin_Count >= PORT_F_PIN_0 && Pin_Count <= PORT_F_PIN_3) )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000002 << (Port_Pins[Pin].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else if(Pin_Count == PORT_D_PIN_0 || Pin_Count == PORT_D_PIN_1 || Pin_Count == PORT_D_PIN_2 || Pin_Count == PORT_D_PIN_3 )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000001 << (Port_Pins[Pin].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else
-                {}
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                
-                break;
-              }
-              case PORT_PIN_MODE_I2C:
-              {
-                if( Pin_Count == PORT_A_PIN_6 || Pin_Count == PORT_A_PIN_7 || Pin_Count == PORT_B_PIN_2 || Pin_Count == PORT_B_PIN_3
-                 || Pin_Count == PORT_D_PIN_0 || Pin_Count == PORT_D_PIN_1 || Pin_Count == PORT_E_PIN_4 || Pin_Count == PORT_E_PIN_5 )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000003 << (Port_Pins[Pin].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else
-                {}
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                
-                break;
-              }
-              case PORT_PIN_MODE_CAN:
-              {
-                if( Pin_Count == PORT_A_PIN_0 || Pin_Count == PORT_A_PIN_1 || Pin_Count == PORT_B_PIN_4 || Pin_Count == PORT_B_PIN_5
-                 || Pin_Count == PORT_E_PIN_4 || Pin_Count == PORT_E_PIN_5 )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000008 << (Port_Pins[Pin].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else if( Pin_Count == PORT_F_PIN_0 || Pin_Count == PORT_F_PIN_3 )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000003 << (Port_Pins[Pin].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else
-                {}
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                
-                break;
-              }
-              case PORT_PIN_MODE_USB:
-              {
-                if( Pin_Count == PORT_B_PIN_0 || Pin_Count == PORT_B_PIN_1 || Pin_Count == PORT_D_PIN_4 || Pin_Count == PORT_D_PIN_5 )
-                {
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);             /* Enable Alternative function for this pin by setting the corresponding bit in GPIOAFSEL register */
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);      /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-                }
-                else if( Pin_Count == PORT_C_PIN_6 || Pin_Count == PORT_C_PIN_7 || Pin_Count == PORT_D_PIN_2 || Pin_Count == PORT_D_PIN_3
-                      || Pin_Count == PORT_F_PIN_4 )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000008 << (Port_Pins[Pin].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                }
-                else
-                {}
-                
-                break;
-              }
-              case PORT_PIN_MODE_GPT:
-              {
-                if( !(Pin_Count <= PORT_A_PIN_7) || !(Pin_Count >= PORT_E_PIN_0 && Pin_Count <= PORT_E_PIN_5)  )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000007 << (Port_Pins[Pin].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else
-                {}
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                
-                break;
-              }
-               case PORT_PIN_MODE_PWM:          /* M1PWM with PD0, PD1, PE4, PE5, PF2 is not handled. */
-              {
-                if( (Pin_Count >= PORT_B_PIN_4 && Pin_Count <= PORT_B_PIN_7) || Pin_Count == PORT_C_PIN_4 || Pin_Count == PORT_C_PIN_5
-                 || Pin_Count == PORT_D_PIN_0 || Pin_Count == PORT_D_PIN_1 || Pin_Count == PORT_D_PIN_2 || Pin_Count == PORT_D_PIN_6 
-                 || Pin_Count == PORT_E_PIN_4 || Pin_Count == PORT_E_PIN_5 || Pin_Count == PORT_F_PIN_2 )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000004 << (Port_Pins[Pin].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else if( Pin_Count == PORT_A_PIN_6 || Pin_Count == PORT_A_PIN_7
-                      || Pin_Count == PORT_F_PIN_0 || Pin_Count == PORT_F_PIN_1 || Pin_Count == PORT_F_PIN_3 || Pin_Count == PORT_F_PIN_4 )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000005 << (Port_Pins[Pin].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                }
-                else
-                {}
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                
-                break;
-              }
-              case PORT_PIN_MODE_QEI:
-              {
-                if( (Pin_Count >= PORT_C_PIN_4 && Pin_Count <= PORT_C_PIN_6) || Pin_Count == PORT_D_PIN_3 || Pin_Count == PORT_D_PIN_6
-                 || Pin_Count == PORT_D_PIN_7 || Pin_Count == PORT_F_PIN_0 || Pin_Count == PORT_F_PIN_1 || Pin_Count == PORT_F_PIN_4 )
+                CLEAR_BIT(Shadow_Ptr->Amsel, Port_Pins[Pin].Pin_Num);
+                Shadow_Ptr->Pctl = (Shadow_Ptr->Pctl & ~(0x0000000FUL << (Port_Pins[Pin].Pin_Num * 4))) | ((uint32)Pmc << (Port_Pins[Pin].Pin_Num * 4));
+                if(Pmc == PORT_PMC_GPIO)
                 {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000006 << (Port_Pins[Pin].Pin_Num * 4));     /* Set the PMCx bits for this pin */
+                    CLEAR_BIT(Shadow_Ptr->Afsel, Port_Pins[Pin].Pin_Num);
                 }
                 else
-                {}
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                
-                break;
-              }
-              case PORT_PIN_MODE_ANALOG_COMP:
-              {
-                if( Pin_Count >= PORT_C_PIN_4 && Pin_Count <= PORT_C_PIN_7 )
                 {
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);             /* Enable Alternative function for this pin by setting the corresponding bit in GPIOAFSEL register */
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);      /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
+                    SET_BIT(Shadow_Ptr->Afsel, Port_Pins[Pin].Pin_Num);
                 }
-                else if( Pin_Count == PORT_F_PIN_0 || Pin_Count == PORT_F_PIN_1 )
-                {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000009 << (Port_Pins[Pin].Pin_Num * 4));     /* Set the PMCx bits for this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                }
-                else
-                {}
+                SET_BIT(Shadow_Ptr->Den, Port_Pins[Pin].Pin_Num);
                 
-                break;
-              }
-              case PORT_PIN_MODE_NMI:
-              {
-                if( Pin_Count == PORT_D_PIN_7 || Pin_Count == PORT_F_PIN_0 )
+                /* Analog functionality is disabled before the digital functionality is enabled */
+                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) = Shadow_Ptr->Amsel;
+                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) = Shadow_Ptr->Pctl;
+                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) = Shadow_Ptr->Afsel;
+                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) = Shadow_Ptr->Den;
+            }
+            else
+            {
+                /* Do Nothing ... mode not available on this pin */
+            }
+#else
+            if(Pmc == PORT_PMC_ANALOG)
+            {
+                CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
+                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);             /* Enable Alternative function for this pin by setting the corresponding bit in GPIOAFSEL register */
+                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000FUL << (Port_Pins[Pin].Pin_Num * 4));   /* Clear the PMCx bits for this pin */
+                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);      /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
+            }
+            else if(Pmc != PORT_PMC_ILLEGAL)
+            {
+                CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);    /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
+                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) = 
+                  (*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) & ~(0x0000000FUL << (Port_Pins[Pin].Pin_Num * 4)))
+                  | ((uint32)Pmc << (Port_Pins[Pin].Pin_Num * 4));                                                                        /* Set the PMCx bits for this pin */
+                if(Pmc == PORT_PMC_GPIO)
                 {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x00000008 << (Port_Pins[Pin].Pin_Num * 4));     /* Set the PMCx bits for this pin */
+                    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);       /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
                 }
                 else
-                {}
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                
-                break;
-              }
-              case PORT_PIN_MODE_TRACE:
-              {
-                if( Pin_Count >= PORT_F_PIN_1 && Pin_Count <= PORT_F_PIN_3 )
                 {
-                  CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_Pins[Pin].Pin_Num);     /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-                  SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);              /* Enable Alternative function for this pin by settomg the corresponding bit in GPIOAFSEL register */
-                  *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (0x0000000E << (Port_Pins[Pin].Pin_Num * 4));     /* Set the PMCx bits for this pin */
+                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_Pins[Pin].Pin_Num);         /* Enable Alternative function for this pin by setting the corresponding bit in GPIOAFSEL register */
                 }
-                else
-                {}
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin].Pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-                
-                break;
-              }
-              
-              default: break;
+                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_Pins[Pin].Pin_Num);       /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
             }
-            
+            else
+            {
+                /* Do Nothing ... mode not available on this pin */
+            }
+#endif
         }
         else
 	{
 		/* No Action Required */
 	}
-  
-  
+}
+#endif
+
+#if (PORT_EDGE_INTERRUPTS == STD_ON)
+/************************************************************************************
+* Service Name: Port_SetEdgeCallBack
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Ptr2Func - Upper layer function called with the port and the pins of the detected edges.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Sets the function called by the GPIO Port ISRs on the edge interrupts.
+************************************************************************************/
+void Port_SetEdgeCallBack(void (*Ptr2Func)(uint8 Port_Num, uint8 Pins_Mask))
+{
+    Port_EdgeCallBack_Ptr = Ptr2Func;
+}
+
+/************************************************************************************
+* Service Name: Port_EdgeIsr
+* Description: Common part of the GPIO Port ISRs: clears the edge interrupts of the port
+*              and notifies the upper layer of the pins with a detected edge.
+************************************************************************************/
+STATIC void Port_EdgeIsr(uint8 Port_Num)
+{
+    volatile uint32 * PortGpio_Ptr = (volatile uint32 *)Port_PortBaseAddress[Port_Num];
+    uint8 Pins_Mask = (uint8)*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_MASKED_INT_STATUS_REG_OFFSET);
+    
+    /* Clear the served edges first so an edge coming during the call back is not lost */
+    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_INT_CLEAR_REG_OFFSET) = Pins_Mask;
+    
+    if(Port_EdgeCallBack_Ptr != NULL_PTR)
+    {
+        (*Port_EdgeCallBack_Ptr)(Port_Num, Pins_Mask);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/************************************************************************************
+* Service Name: GPIOPortA_Handler to GPIOPortF_Handler
+* Description: GPIO Port ISRs
+************************************************************************************/
+void GPIOPortA_Handler(void)
+{
+    Port_EdgeIsr(PORT_A);
+}
+
+void GPIOPortB_Handler(void)
+{
+    Port_EdgeIsr(PORT_B);
+}
+
+void GPIOPortC_Handler(void)
+{
+    Port_EdgeIsr(PORT_C);
+}
+
+void GPIOPortD_Handler(void)
+{
+    Port_EdgeIsr(PORT_D);
+}
+
+void GPIOPortE_Handler(void)
+{
+    Port_EdgeIsr(PORT_E);
+}
+
+void GPIOPortF_Handler(void)
+{
+    Port_EdgeIsr(PORT_F);
 }
 #endif
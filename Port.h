@@ -124,9 +124,31 @@
  *                              Module Data Types                              *
  *******************************************************************************/
 
-/* Description: Unsigned char to hold mode type for PIN */
+/* Description: Unsigned char to hold mode type for PIN,
+ *              the low nibble holds the PORT_PIN_MODE_* ID and the high nibble optionally holds
+ *              the PMCx value of one of the alternative functions of this mode on the pin
+ */
 typedef uint8 Port_PinModeType;
 
+/* Port Pin mode with an explicit PMCx value, e.g. PORT_PIN_MODE_WITH_PMC(PORT_PIN_MODE_SSI, 2) for SSI1 on PD0 to PD3 */
+#define PORT_PIN_MODE_WITH_PMC(MODE, PMC)       (Port_PinModeType)(((PMC) << 4) | (MODE))
+
+/* PORT_PIN_MODE_* ID and explicit PMCx value (0 for the default function) of a Port Pin mode */
+#define PORT_PIN_MODE_ID(MODE)                  ((MODE) & 0x0F)
+#define PORT_PIN_MODE_PMC(MODE)                 ((MODE) >> 4)
+
+/* Pin mux values held by the pin mux table in addition to the PMCx values */
+#define PORT_PMC_GPIO                   (uint8)0x00     /* No alternative function */
+#define PORT_PMC_ANALOG                 (uint8)0x10     /* Analog function: AFSEL and AMSEL set, digital disabled */
+#define PORT_PMC_ILLEGAL                (uint8)0xFF     /* Mode not available on the pin */
+
+/* Description: Pin mux table entry of one mode on one pin:
+ *	1. bits 0 to 7   --> default PMCx value, PORT_PMC_GPIO, PORT_PMC_ANALOG or PORT_PMC_ILLEGAL
+ *	2. bits 8 to 11  --> PMCx value of the first alternative function of the mode (0 if none)
+ *	3. bits 12 to 15 --> PMCx value of the second alternative function of the mode (0 if none)
+ */
+typedef uint16 Port_PinModePmcType;
+
 /* Description: Unsigned char to hold the port pin number */
 typedef uint8 Port_PinType;
    
@@ -150,6 +172,12 @@ typedef enum
     R8R
 }Port_PinOutputCurrentType;
 
+/* Description: Enum to hold the edge interrupt of an input PIN */
+typedef enum
+{
+    PORT_PIN_EDGE_NONE, PORT_PIN_EDGE_RISING, PORT_PIN_EDGE_FALLING, PORT_PIN_EDGE_BOTH
+}Port_PinEdgeType;
+
 /* Description: Structure to configure each individual PIN:
  *	1. the mode of the port pin
  *	2. the PORT Which the pin belongs to: 0, 1, 2, 3, 4 or 5
@@ -159,6 +187,7 @@ typedef enum
  *      6. the initial value of pin level
  *      7. the pin direction changeable during run time --> ON or OFF
  *      8. the pin mode changeable during run time --> ON or OFF
+ *      9. the edge interrupt of an input pin --> None, Rising, Falling or Both edges
  */
 typedef struct 
 { 
@@ -177,12 +206,57 @@ typedef struct
     uint8 Pin_Slew_Rate;
     #endif
     
+    #if (PORT_EDGE_INTERRUPTS == STD_ON)
+    Port_PinEdgeType Port_Pin_Edge;
+    #endif
+    
 }Port_ConfigPin;
 
+/* Description: Structure to hold the register image of one port reduced from its pins configuration,
+ *              each member holds one bit per pin of the port except Pctl which holds the PMCx nibbles
+ */
+typedef struct
+{
+    uint8 Pins_Mask;    /* configured pins of the port */
+    uint8 Mode_Mask;    /* configured pins whose mode registers are written (JTAG pins excluded) */
+    uint8 Commit;       /* locked pins to be committed before being configured */
+    uint8 Dir;
+    uint8 Data;
+    uint8 Den;
+    uint8 Afsel;
+    uint8 Amsel;
+    uint8 Pur;
+    uint8 Pdr;
+    uint8 Odr;
+    uint8 Dr2r;
+    uint8 Dr4r;
+    uint8 Dr8r;
+    uint8 Slr;
+    uint8 Ibe;          /* edge interrupt pins sensing both edges */
+    uint8 Iev;          /* edge interrupt pins sensing the rising edge */
+    uint8 Im;           /* edge interrupt pins */
+    uint32 Pctl;
+}Port_RegImageType;
+
+/* Description: Structure to hold the RAM shadow of the mode and direction registers of one port,
+ *              the driver writes the whole registers from it instead of reading them back
+ */
+typedef struct
+{
+    uint8 Dir;
+    uint8 Den;
+    uint8 Afsel;
+    uint8 Amsel;
+    uint32 Pctl;
+}Port_ShadowRegType;
+
 /* Data Structure required for initializing the Port Driver */
 typedef struct
 {
   Port_ConfigPin Pins[PORT_NUMBER_OF_PORT_PINS];
+#if (PORT_PRECOMPUTED_REG_IMAGES == STD_ON)
+  Port_RegImageType Ports[PORT_NUMBER_OF_PORTS];
+#endif
 }Port_ConfigType;
 
 /*******************************************************************************
@@ -198,13 +272,29 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction);
 /* Function for PORT refresh Port Direction API */
 void Port_RefreshPortDirection(void);
 
+/* Function to get the number of drifted ports detected by Port_RefreshPortDirection */
+uint32 Port_GetDirectionDriftCount(void);
+
 #if (PORT_VERSION_INFO_API == STD_ON)
 /* Function for PORT Get Version Info API */
 void Port_GetVersionInfo(Std_VersionInfoType *versioninfo);
 #endif
 
 /* Function for PORT set Pin Mode API */
-void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Direction);
+void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode);
+
+#if (PORT_EDGE_INTERRUPTS == STD_ON)
+/* Function to set the upper layer function called by the GPIO Port ISRs with the port and the pins of the detected edges */
+void Port_SetEdgeCallBack(void (*Ptr2Func)(uint8 Port_Num, uint8 Pins_Mask));
+
+/* GPIO Port ISRs of the edge interrupts, set by Port_Init below the priority of the SysTick ISR */
+void GPIOPortA_Handler(void);
+void GPIOPortB_Handler(void);
+void GPIOPortC_Handler(void);
+void GPIOPortD_Handler(void);
+void GPIOPortE_Handler(void);
+void GPIOPortF_Handler(void);
+#endif
   
 /*******************************************************************************
  *                       External Variables                                    *
@@ -213,4 +303,7 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Direction);
 /* Extern PB structures to be used by Port and other modules */
 extern const Port_ConfigType Port_Configuration;
 
+/* Extern pin mux table of each Port Pin and mode, generated in Port_Lcfg.c */
+extern const Port_PinModePmcType Port_PinModePmc[PORT_NUMBER_OF_PORT_PINS][PORT_NUMBER_OF_PORT_PIN_MODES];
+
 #endif /* PORT_H */
@@ -5,6 +5,7 @@
  * File Name: Port_Cfg.h
  *
  * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Port Driver
+ *              Generated by Tools/Port_Gen.py from Port_Config.json
  *
  * Author: Ahmed Essam
  ******************************************************************************/
@@ -28,7 +29,7 @@
 
 /* Pre-compile option for Development Error Detect */
 #define PORT_DEV_ERROR_DETECT                (STD_ON)
-   
+
 /* Pre-compile option for Set Pin Direction API */
 #define PORT_SET_PIN_DIRECTION_API           (STD_ON)
 
@@ -40,40 +41,55 @@
 
 /* Pre-compile option for optional MCU Ports and Port Pins Configurations */
 #define PORT_OPTIONAL_CONFIG                 (STD_OFF)
-   
+
+/* Pre-compile option for using the port register images precomputed by Tools/Port_Gen.py in Port_PBcfg.c */
+#define PORT_PRECOMPUTED_REG_IMAGES          (STD_ON)
+
+/*
+ * Pre-compile option for moving the used ports to the AHB aperture in Port_Init instead of the legacy APB aperture.
+ * The Dio Driver uses the base addresses of the Port Driver so it always follows this option.
+ */
+#define PORT_GPIO_AHB_APERTURE               (STD_ON)
+
+/* Pre-compile option for the RAM shadow of the direction and mode registers, so the APIs never read them back */
+#define PORT_SHADOW_REGISTERS                (STD_ON)
+
+/* Pre-compile option for the edge interrupts of the input pins and the GPIO Port ISRs */
+#define PORT_EDGE_INTERRUPTS                 (STD_ON)
+
 /* Microcontroller Port Pin Mode ID's */
 #define PORT_PIN_MODE_DIO              (uint8)0
-#define PORT_PIN_MODE_ADC              (uint8)1   
+#define PORT_PIN_MODE_ADC              (uint8)1
 #define PORT_PIN_MODE_UART             (uint8)2
-#define PORT_PIN_MODE_SSI              (uint8)3      
+#define PORT_PIN_MODE_SSI              (uint8)3
 #define PORT_PIN_MODE_I2C              (uint8)4
-#define PORT_PIN_MODE_CAN              (uint8)5   
+#define PORT_PIN_MODE_CAN              (uint8)5
 #define PORT_PIN_MODE_USB              (uint8)6
 #define PORT_PIN_MODE_GPT              (uint8)7
-#define PORT_PIN_MODE_PWM              (uint8)8   
+#define PORT_PIN_MODE_PWM              (uint8)8
 #define PORT_PIN_MODE_QEI              (uint8)9
 #define PORT_PIN_MODE_ANALOG_COMP      (uint8)10
-#define PORT_PIN_MODE_NMI              (uint8)11   
+#define PORT_PIN_MODE_NMI              (uint8)11
 #define PORT_PIN_MODE_TRACE            (uint8)12
 
 /* Port Configured Port ID's */
-#define PORT_A          (uint8)0   
-#define PORT_B          (uint8)1  
-#define PORT_C          (uint8)2   
-#define PORT_D          (uint8)3  
-#define PORT_E          (uint8)4   
-#define PORT_F          (uint8)5  
-   
+#define PORT_A          (uint8)0
+#define PORT_B          (uint8)1
+#define PORT_C          (uint8)2
+#define PORT_D          (uint8)3
+#define PORT_E          (uint8)4
+#define PORT_F          (uint8)5
+
 /* Port Configured Port Pin ID's */
-#define PIN_0          (uint8)0   
-#define PIN_1          (uint8)1  
-#define PIN_2          (uint8)2   
-#define PIN_3          (uint8)3  
-#define PIN_4          (uint8)4   
-#define PIN_5          (uint8)5  
-#define PIN_6          (uint8)6  
-#define PIN_7          (uint8)7  
-   
+#define PIN_0          (uint8)0
+#define PIN_1          (uint8)1
+#define PIN_2          (uint8)2
+#define PIN_3          (uint8)3
+#define PIN_4          (uint8)4
+#define PIN_5          (uint8)5
+#define PIN_6          (uint8)6
+#define PIN_7          (uint8)7
+
 /* Port Pin ID numbers */
 #define PORT_A_PIN_0    (Port_PinType)0
 #define PORT_A_PIN_1    (Port_PinType)1
@@ -83,50 +99,53 @@
 #define PORT_A_PIN_5    (Port_PinType)5
 #define PORT_A_PIN_6    (Port_PinType)6
 #define PORT_A_PIN_7    (Port_PinType)7
-   
+
 #define PORT_B_PIN_0    (Port_PinType)8
 #define PORT_B_PIN_1    (Port_PinType)9
-#define PORT_B_PIN_2    (Port_PinType)10 
-#define PORT_B_PIN_3    (Port_PinType)11 
-#define PORT_B_PIN_4    (Port_PinType)12 
-#define PORT_B_PIN_5    (Port_PinType)13 
+#define PORT_B_PIN_2    (Port_PinType)10
+#define PORT_B_PIN_3    (Port_PinType)11
+#define PORT_B_PIN_4    (Port_PinType)12
+#define PORT_B_PIN_5    (Port_PinType)13
 #define PORT_B_PIN_6    (Port_PinType)14
 #define PORT_B_PIN_7    (Port_PinType)15
-   
+
 #define PORT_C_PIN_0    (Port_PinType)16
-#define PORT_C_PIN_1    (Port_PinType)17 
+#define PORT_C_PIN_1    (Port_PinType)17
 #define PORT_C_PIN_2    (Port_PinType)18
 #define PORT_C_PIN_3    (Port_PinType)19
 #define PORT_C_PIN_4    (Port_PinType)20
 #define PORT_C_PIN_5    (Port_PinType)21
-#define PORT_C_PIN_6    (Port_PinType)22 
+#define PORT_C_PIN_6    (Port_PinType)22
 #define PORT_C_PIN_7    (Port_PinType)23
-   
+
 #define PORT_D_PIN_0    (Port_PinType)24
-#define PORT_D_PIN_1    (Port_PinType)25   
-#define PORT_D_PIN_2    (Port_PinType)26   
-#define PORT_D_PIN_3    (Port_PinType)27   
-#define PORT_D_PIN_4    (Port_PinType)28   
-#define PORT_D_PIN_5    (Port_PinType)29   
-#define PORT_D_PIN_6    (Port_PinType)30   
+#define PORT_D_PIN_1    (Port_PinType)25
+#define PORT_D_PIN_2    (Port_PinType)26
+#define PORT_D_PIN_3    (Port_PinType)27
+#define PORT_D_PIN_4    (Port_PinType)28
+#define PORT_D_PIN_5    (Port_PinType)29
+#define PORT_D_PIN_6    (Port_PinType)30
 #define PORT_D_PIN_7    (Port_PinType)31
-   
+
 #define PORT_E_PIN_0    (Port_PinType)32
 #define PORT_E_PIN_1    (Port_PinType)33
 #define PORT_E_PIN_2    (Port_PinType)34
 #define PORT_E_PIN_3    (Port_PinType)35
 #define PORT_E_PIN_4    (Port_PinType)36
 #define PORT_E_PIN_5    (Port_PinType)37
-   
+
 #define PORT_F_PIN_0    (Port_PinType)38
 #define PORT_F_PIN_1    (Port_PinType)39
 #define PORT_F_PIN_2    (Port_PinType)40
 #define PORT_F_PIN_3    (Port_PinType)41
-#define PORT_F_PIN_4    (Port_PinType)42   
+#define PORT_F_PIN_4    (Port_PinType)42
+
+/* Number of the GPIO Ports in the Microcontroller */
+#define PORT_NUMBER_OF_PORTS            (6U)
 
 /* Number of the configured Port Pins */
 #define PORT_NUMBER_OF_PORT_PINS        (43U)
-   
+
 /* Number of the configured Port Pin Modes */
 #define PORT_NUMBER_OF_PORT_PIN_MODES      (13U)
 
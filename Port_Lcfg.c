@@ -4,7 +4,8 @@
  *
  * File Name: Port_Lcfg.c
  *
- * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Port Driver
+ * Description: Link Time Configuration Source file for TM4C123GH6PM Microcontroller - Port Driver
+ *              Generated by Tools/Port_Gen.py from the TM4C123GH6PM datasheet pin mux matrix
  *
  * Author: Ahmed Essam
  ******************************************************************************/
@@ -25,17 +26,70 @@
 
 #include "Port.h"
 
-/* AUTOSAR Version checking between Port_PBcfg.c and Port.h files */
+/* AUTOSAR Version checking between Port_Lcfg.c and Port.h files */
 #if ((PORT_LCFG_AR_RELEASE_MAJOR_VERSION != PORT_AR_RELEASE_MAJOR_VERSION)\
  ||  (PORT_LCFG_AR_RELEASE_MINOR_VERSION != PORT_AR_RELEASE_MINOR_VERSION)\
  ||  (PORT_LCFG_AR_RELEASE_PATCH_VERSION != PORT_AR_RELEASE_PATCH_VERSION))
   #error "The AR version of Port_Lcfg.c does not match the expected version"
 #endif
 
-/* Software Version checking between Port_PBcfg.c and Dio.h files */
+/* Software Version checking between Port_Lcfg.c and Port.h files */
 #if ((PORT_LCFG_SW_MAJOR_VERSION != PORT_SW_MAJOR_VERSION)\
  ||  (PORT_LCFG_SW_MINOR_VERSION != PORT_SW_MINOR_VERSION)\
  ||  (PORT_LCFG_SW_PATCH_VERSION != PORT_SW_PATCH_VERSION))
   #error "The SW version of Port_Lcfg.c does not match the expected version"
 #endif
-   
+
+/* Pin mux table used with Port_Init and Port_SetPinMode APIs, one entry per Port Pin and mode:
+ * DIO, ADC, UART, SSI, I2C, CAN, USB, GPT, PWM, QEI, ANALOG_COMP, NMI, TRACE
+ */
+const Port_PinModePmcType Port_PinModePmc[PORT_NUMBER_OF_PORT_PINS][PORT_NUMBER_OF_PORT_PIN_MODES] = {
+    {0x0000, 0x00FF, 0x0001, 0x00FF, 0x00FF, 0x0008, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PA0: U0Rx CAN1Rx */
+    {0x0000, 0x00FF, 0x0001, 0x00FF, 0x00FF, 0x0008, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PA1: U0Tx CAN1Tx */
+    {0x0000, 0x00FF, 0x00FF, 0x0002, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PA2: SSI0Clk */
+    {0x0000, 0x00FF, 0x00FF, 0x0002, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PA3: SSI0Fss */
+    {0x0000, 0x00FF, 0x00FF, 0x0002, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PA4: SSI0Rx */
+    {0x0000, 0x00FF, 0x00FF, 0x0002, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PA5: SSI0Tx */
+    {0x0000, 0x00FF, 0x00FF, 0x00FF, 0x0003, 0x00FF, 0x00FF, 0x00FF, 0x0005, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PA6: I2C1SCL M1PWM2 */
+    {0x0000, 0x00FF, 0x00FF, 0x00FF, 0x0003, 0x00FF, 0x00FF, 0x00FF, 0x0005, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PA7: I2C1SDA M1PWM3 */
+
+    {0x0000, 0x00FF, 0x0001, 0x00FF, 0x00FF, 0x00FF, 0x0010, 0x0007, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PB0: USB0ID U1Rx T2CCP0 */
+    {0x0000, 0x00FF, 0x0001, 0x00FF, 0x00FF, 0x00FF, 0x0010, 0x0007, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PB1: USB0VBUS U1Tx T2CCP1 */
+    {0x0000, 0x00FF, 0x00FF, 0x00FF, 0x0003, 0x00FF, 0x00FF, 0x0007, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PB2: I2C0SCL T3CCP0 */
+    {0x0000, 0x00FF, 0x00FF, 0x00FF, 0x0003, 0x00FF, 0x00FF, 0x0007, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PB3: I2C0SDA T3CCP1 */
+    {0x0000, 0x0010, 0x00FF, 0x0002, 0x00FF, 0x0008, 0x00FF, 0x0007, 0x0004, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PB4: AIN10 SSI2Clk M0PWM2 T1CCP0 CAN0Rx */
+    {0x0000, 0x0010, 0x00FF, 0x0002, 0x00FF, 0x0008, 0x00FF, 0x0007, 0x0004, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PB5: AIN11 SSI2Fss M0PWM3 T1CCP1 CAN0Tx */
+    {0x0000, 0x00FF, 0x00FF, 0x0002, 0x00FF, 0x00FF, 0x00FF, 0x0007, 0x0004, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PB6: SSI2Rx M0PWM0 T0CCP0 */
+    {0x0000, 0x00FF, 0x00FF, 0x0002, 0x00FF, 0x00FF, 0x00FF, 0x0007, 0x0004, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PB7: SSI2Tx M0PWM1 T0CCP1 */
+
+    {0x0000, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0007, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PC0: TCK T4CCP0 */
+    {0x0000, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0007, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PC1: TMS T4CCP1 */
+    {0x0000, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0007, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PC2: TDI T5CCP0 */
+    {0x0000, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0007, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PC3: TDO T5CCP1 */
+    {0x0000, 0x00FF, 0x8201, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0007, 0x0004, 0x0006, 0x0010, 0x00FF, 0x00FF},    /* PC4: C1- U4Rx U1Rx M0PWM6 IDX1 WT0CCP0 U1RTS */
+    {0x0000, 0x00FF, 0x8201, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0007, 0x0004, 0x0006, 0x0010, 0x00FF, 0x00FF},    /* PC5: C1+ U4Tx U1Tx M0PWM7 PhA1 WT0CCP1 U1CTS */
+    {0x0000, 0x00FF, 0x0001, 0x00FF, 0x00FF, 0x00FF, 0x0008, 0x0007, 0x00FF, 0x0006, 0x0010, 0x00FF, 0x00FF},    /* PC6: C0+ U3Rx PhB1 WT1CCP0 USB0EPEN */
+    {0x0000, 0x00FF, 0x0001, 0x00FF, 0x00FF, 0x00FF, 0x0008, 0x0007, 0x00FF, 0x00FF, 0x0010, 0x00FF, 0x00FF},    /* PC7: C0- U3Tx WT1CCP1 USB0PFLT */
+
+    {0x0000, 0x0010, 0x00FF, 0x0201, 0x0003, 0x00FF, 0x00FF, 0x0007, 0x0504, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PD0: AIN7 SSI3Clk SSI1Clk I2C3SCL M0PWM6 M1PWM0 WT2CCP0 */
+    {0x0000, 0x0010, 0x00FF, 0x0201, 0x0003, 0x00FF, 0x00FF, 0x0007, 0x0504, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PD1: AIN6 SSI3Fss SSI1Fss I2C3SDA M0PWM7 M1PWM1 WT2CCP1 */
+    {0x0000, 0x0010, 0x00FF, 0x0201, 0x00FF, 0x00FF, 0x0008, 0x0007, 0x0004, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PD2: AIN5 SSI3Rx SSI1Rx M0FAULT0 WT3CCP0 USB0EPEN */
+    {0x0000, 0x0010, 0x00FF, 0x0201, 0x00FF, 0x00FF, 0x0008, 0x0007, 0x00FF, 0x0006, 0x00FF, 0x00FF, 0x00FF},    /* PD3: AIN4 SSI3Tx SSI1Tx IDX0 WT3CCP1 USB0PFLT */
+    {0x0000, 0x00FF, 0x0001, 0x00FF, 0x00FF, 0x00FF, 0x0010, 0x0007, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PD4: USB0DM U6Rx WT4CCP0 */
+    {0x0000, 0x00FF, 0x0001, 0x00FF, 0x00FF, 0x00FF, 0x0010, 0x0007, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PD5: USB0DP U6Tx WT4CCP1 */
+    {0x0000, 0x00FF, 0x0001, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0007, 0x0004, 0x0006, 0x00FF, 0x00FF, 0x00FF},    /* PD6: U2Rx M0FAULT0 PhA0 WT5CCP0 */
+    {0x0000, 0x00FF, 0x0001, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0007, 0x00FF, 0x0006, 0x00FF, 0x0008, 0x00FF},    /* PD7: U2Tx PhB0 WT5CCP1 NMI */
+
+    {0x0000, 0x0010, 0x0001, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PE0: AIN3 U7Rx */
+    {0x0000, 0x0010, 0x0001, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PE1: AIN2 U7Tx */
+    {0x0000, 0x0010, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PE2: AIN1 */
+    {0x0000, 0x0010, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PE3: AIN0 */
+    {0x0000, 0x0010, 0x0001, 0x00FF, 0x0003, 0x0008, 0x00FF, 0x00FF, 0x0504, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PE4: AIN9 U5Rx I2C2SCL M0PWM4 M1PWM2 CAN0Rx */
+    {0x0000, 0x0010, 0x0001, 0x00FF, 0x0003, 0x0008, 0x00FF, 0x00FF, 0x0504, 0x00FF, 0x00FF, 0x00FF, 0x00FF},    /* PE5: AIN8 U5Tx I2C2SDA M0PWM5 M1PWM3 CAN0Tx */
+
+    {0x0000, 0x00FF, 0x0001, 0x0002, 0x00FF, 0x0003, 0x00FF, 0x0007, 0x0005, 0x0006, 0x0009, 0x0008, 0x00FF},    /* PF0: U1RTS SSI1Rx CAN0Rx M1PWM4 PhA0 T0CCP0 NMI C0o */
+    {0x0000, 0x00FF, 0x0001, 0x0002, 0x00FF, 0x00FF, 0x00FF, 0x0007, 0x0005, 0x0006, 0x0009, 0x00FF, 0x000E},    /* PF1: U1CTS SSI1Tx M1PWM5 IDX1 T0CCP1 C1o TRD1 */
+    {0x0000, 0x00FF, 0x00FF, 0x0002, 0x00FF, 0x00FF, 0x00FF, 0x0007, 0x0504, 0x00FF, 0x00FF, 0x00FF, 0x000E},    /* PF2: SSI1Clk M0FAULT0 M1PWM6 T1CCP0 TRD0 */
+    {0x0000, 0x00FF, 0x00FF, 0x0002, 0x00FF, 0x0003, 0x00FF, 0x0007, 0x0005, 0x00FF, 0x00FF, 0x00FF, 0x000E},    /* PF3: SSI1Fss CAN0Tx M1PWM7 T1CCP1 TRCLK */
+    {0x0000, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0008, 0x0007, 0x0005, 0x0006, 0x00FF, 0x00FF, 0x00FF}     /* PF4: M1FAULT0 IDX0 T2CCP0 USB0EPEN */
+};
@@ -5,6 +5,7 @@
  * File Name: Port_PBcfg.c
  *
  * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Port Driver
+ *              Generated by Tools/Port_Gen.py from Port_Config.json
  *
  * Author: Ahmed Essam
  ******************************************************************************/
@@ -32,7 +33,7 @@
   #error "The AR version of Port_PBcfg.c does not match the expected version"
 #endif
 
-/* Software Version checking between Dio_PBcfg.c and Dio.h files */
+/* Software Version checking between Port_PBcfg.c and Port.h files */
 #if ((PORT_PBCFG_SW_MAJOR_VERSION != PORT_SW_MAJOR_VERSION)\
  ||  (PORT_PBCFG_SW_MINOR_VERSION != PORT_SW_MINOR_VERSION)\
  ||  (PORT_PBCFG_SW_PATCH_VERSION != PORT_SW_PATCH_VERSION))
@@ -41,59 +42,71 @@
 
 /* PB structure used with Port_Init API */
 const Port_ConfigType Port_Configuration = {
-                                           /* port pin mode, port_num, pin_num, directon, resstor, init value, changeable_pindirection, changeable_pinmode, open drain mode, output current, slew rate control */
-                                             /* PORTA */
-                                             PORT_PIN_MODE_DIO, PORT_A, PIN_0, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, 
-                                             PORT_PIN_MODE_DIO, PORT_A, PIN_1, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_A, PIN_2, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_A, PIN_3, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,	
-                                             PORT_PIN_MODE_DIO, PORT_A, PIN_4, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_A, PIN_5, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_A, PIN_6, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,	
-                                             PORT_PIN_MODE_DIO, PORT_A, PIN_7, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,		
-                                                                                                                              
-                                             /* PORTB */                                                                      
-                                             PORT_PIN_MODE_DIO, PORT_B, PIN_0, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_B, PIN_1, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_B, PIN_2, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,	
-                                             PORT_PIN_MODE_DIO, PORT_B, PIN_3, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,	
-                                             PORT_PIN_MODE_DIO, PORT_B, PIN_4, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_B, PIN_5, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_B, PIN_6, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,	
-                                             PORT_PIN_MODE_DIO, PORT_B, PIN_7, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                                                                                                              
-                                             /* PORTC */                                                                      
-                                             PORT_PIN_MODE_DIO, PORT_C, PIN_0, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_C, PIN_1, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_C, PIN_2, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,	
-                                             PORT_PIN_MODE_DIO, PORT_C, PIN_3, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,	
-                                             PORT_PIN_MODE_DIO, PORT_C, PIN_4, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_C, PIN_5, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_C, PIN_6, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,	
-                                             PORT_PIN_MODE_DIO, PORT_C, PIN_7, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                                                                                                              
-                                             /* PORTD */                                                                      
-                                             PORT_PIN_MODE_DIO, PORT_D, PIN_0, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_D, PIN_1, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_D, PIN_2, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,	
-                                             PORT_PIN_MODE_DIO, PORT_D, PIN_3, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,	
-                                             PORT_PIN_MODE_DIO, PORT_D, PIN_4, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_D, PIN_5, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_D, PIN_6, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,	
-                                             PORT_PIN_MODE_DIO, PORT_D, PIN_7, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                                                                                                              
-                                             /* PORTE  */                                                                     
-                                             PORT_PIN_MODE_DIO, PORT_E, PIN_0, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_E, PIN_1, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_E, PIN_2, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,	
-                                             PORT_PIN_MODE_DIO, PORT_E, PIN_3, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,	
-                                             PORT_PIN_MODE_DIO, PORT_E, PIN_4, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_E, PIN_5, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF,
-                                                                                                                                     
-                                             /* PORTF */                                                                               
-                                             PORT_PIN_MODE_DIO, PORT_F, PIN_0, PORT_PIN_IN, PULL_UP, STD_LOW, STD_OFF, STD_OFF,
-                                             PORT_PIN_MODE_DIO, PORT_F, PIN_1, PORT_PIN_OUT, OFF, STD_LOW, STD_OFF, STD_OFF,        /* Pin 1 represents Red LED on Port F */
-                                             PORT_PIN_MODE_DIO, PORT_F, PIN_2, PORT_PIN_OUT, OFF, STD_LOW, STD_OFF, STD_OFF, 	/* Pin 2 represents Blue LED on Port F */
-                                             PORT_PIN_MODE_DIO, PORT_F, PIN_3, PORT_PIN_OUT, OFF, STD_LOW, STD_OFF, STD_OFF, 	/* Pin 3 represents Green LED on Port F */
-                                             PORT_PIN_MODE_DIO, PORT_F, PIN_4, PORT_PIN_IN, PULL_UP, STD_HIGH, STD_OFF, STD_OFF, 
-				         };
\ No newline at end of file
+                                             /* Pins: port pin mode, port_num, pin_num, directon, resistor, init value, changeable_pindirection, changeable_pinmode, edge interrupt */
+                                             {
+                                               /* PORTA */
+                                               {PORT_PIN_MODE_DIO, PORT_A, PIN_0, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_A, PIN_1, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_A, PIN_2, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_A, PIN_3, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_A, PIN_4, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_A, PIN_5, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_A, PIN_6, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_A, PIN_7, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+
+                                               /* PORTB */
+                                               {PORT_PIN_MODE_DIO, PORT_B, PIN_0, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_B, PIN_1, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_B, PIN_2, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_B, PIN_3, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_B, PIN_4, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_B, PIN_5, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_B, PIN_6, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_B, PIN_7, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+
+                                               /* PORTC */
+                                               {PORT_PIN_MODE_DIO, PORT_C, PIN_0, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_C, PIN_1, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_C, PIN_2, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_C, PIN_3, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_C, PIN_4, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_C, PIN_5, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_C, PIN_6, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_C, PIN_7, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+
+                                               /* PORTD */
+                                               {PORT_PIN_MODE_DIO, PORT_D, PIN_0, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_D, PIN_1, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_D, PIN_2, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_D, PIN_3, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_D, PIN_4, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_D, PIN_5, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_D, PIN_6, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_D, PIN_7, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+
+                                               /* PORTE */
+                                               {PORT_PIN_MODE_DIO, PORT_E, PIN_0, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_E, PIN_1, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_E, PIN_2, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_E, PIN_3, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_E, PIN_4, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_E, PIN_5, PORT_PIN_IN, PULL_DOWN, STD_LOW, STD_ON, STD_OFF, PORT_PIN_EDGE_NONE},
+
+                                               /* PORTF */
+                                               {PORT_PIN_MODE_DIO, PORT_F, PIN_0, PORT_PIN_IN, PULL_UP, STD_LOW, STD_OFF, STD_OFF, PORT_PIN_EDGE_NONE},
+                                               {PORT_PIN_MODE_DIO, PORT_F, PIN_1, PORT_PIN_OUT, OFF, STD_LOW, STD_OFF, STD_OFF, PORT_PIN_EDGE_NONE},    /* Pin 1 represents Red LED on Port F */
+                                               {PORT_PIN_MODE_DIO, PORT_F, PIN_2, PORT_PIN_OUT, OFF, STD_LOW, STD_OFF, STD_OFF, PORT_PIN_EDGE_NONE},    /* Pin 2 represents Blue LED on Port F */
+                                               {PORT_PIN_MODE_DIO, PORT_F, PIN_3, PORT_PIN_OUT, OFF, STD_LOW, STD_OFF, STD_OFF, PORT_PIN_EDGE_NONE},    /* Pin 3 represents Green LED on Port F */
+                                               {PORT_PIN_MODE_DIO, PORT_F, PIN_4, PORT_PIN_IN, PULL_UP, STD_HIGH, STD_OFF, STD_OFF, PORT_PIN_EDGE_BOTH}    /* Pin 4 represents SW1 on Port F */
+                                             },
+
+                                             /* Ports register images: Pins_Mask, Mode_Mask, Commit, Dir, Data, Den, Afsel, Amsel, Pur, Pdr, Odr, Dr2r, Dr4r, Dr8r, Slr, Ibe, Iev, Im, Pctl */
+                                             {
+                                               {0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000UL},    /* PORTA */
+                                               {0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000UL},    /* PORTB */
+                                               {0xFF, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000UL},    /* PORTC */
+                                               {0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000UL},    /* PORTD */
+                                               {0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00000000UL},    /* PORTE */
+                                               {0x1F, 0x1F, 0x01, 0x0E, 0x00, 0x1F, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00000000UL}    /* PORTF */
+                                             }
+                                         };
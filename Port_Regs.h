@@ -13,16 +13,46 @@
 #define PORT_REGS_H
 
 #include "Std_Types.h"
+#include "Port_Cfg.h"
 
 #define SYSCTL_REGCGC2_REG        (*((volatile uint32 *)0x400FE108))
+#define SYSCTL_GPIOHBCTL_REG      (*((volatile uint32 *)0x400FE06C))
 
-/* GPIO Registers base addresses */
-#define GPIO_PORTA_BASE_ADDRESS           0x40004000
-#define GPIO_PORTB_BASE_ADDRESS           0x40005000
-#define GPIO_PORTC_BASE_ADDRESS           0x40006000
-#define GPIO_PORTD_BASE_ADDRESS           0x40007000
-#define GPIO_PORTE_BASE_ADDRESS           0x40024000
-#define GPIO_PORTF_BASE_ADDRESS           0x40025000
+/* GPIO Registers base addresses on the legacy APB aperture */
+#define GPIO_PORTA_APB_BASE_ADDRESS       0x40004000
+#define GPIO_PORTB_APB_BASE_ADDRESS       0x40005000
+#define GPIO_PORTC_APB_BASE_ADDRESS       0x40006000
+#define GPIO_PORTD_APB_BASE_ADDRESS       0x40007000
+#define GPIO_PORTE_APB_BASE_ADDRESS       0x40024000
+#define GPIO_PORTF_APB_BASE_ADDRESS       0x40025000
+
+/* GPIO Registers base addresses on the AHB aperture */
+#define GPIO_PORTA_AHB_BASE_ADDRESS       0x40058000
+#define GPIO_PORTB_AHB_BASE_ADDRESS       0x40059000
+#define GPIO_PORTC_AHB_BASE_ADDRESS       0x4005A000
+#define GPIO_PORTD_AHB_BASE_ADDRESS       0x4005B000
+#define GPIO_PORTE_AHB_BASE_ADDRESS       0x4005C000
+#define GPIO_PORTF_AHB_BASE_ADDRESS       0x4005D000
+
+/* GPIO Registers base addresses on the aperture selected by PORT_GPIO_AHB_APERTURE */
+#if (PORT_GPIO_AHB_APERTURE == STD_ON)
+#define GPIO_PORTA_BASE_ADDRESS           GPIO_PORTA_AHB_BASE_ADDRESS
+#define GPIO_PORTB_BASE_ADDRESS           GPIO_PORTB_AHB_BASE_ADDRESS
+#define GPIO_PORTC_BASE_ADDRESS           GPIO_PORTC_AHB_BASE_ADDRESS
+#define GPIO_PORTD_BASE_ADDRESS           GPIO_PORTD_AHB_BASE_ADDRESS
+#define GPIO_PORTE_BASE_ADDRESS           GPIO_PORTE_AHB_BASE_ADDRESS
+#define GPIO_PORTF_BASE_ADDRESS           GPIO_PORTF_AHB_BASE_ADDRESS
+#else
+#define GPIO_PORTA_BASE_ADDRESS           GPIO_PORTA_APB_BASE_ADDRESS
+#define GPIO_PORTB_BASE_ADDRESS           GPIO_PORTB_APB_BASE_ADDRESS
+#define GPIO_PORTC_BASE_ADDRESS           GPIO_PORTC_APB_BASE_ADDRESS
+#define GPIO_PORTD_BASE_ADDRESS           GPIO_PORTD_APB_BASE_ADDRESS
+#define GPIO_PORTE_BASE_ADDRESS           GPIO_PORTE_APB_BASE_ADDRESS
+#define GPIO_PORTF_BASE_ADDRESS           GPIO_PORTF_APB_BASE_ADDRESS
+#endif
+
+/* GPIO base address of each port indexed by the Port Id, defined in Port.c and also used by the Dio Driver */
+extern const uint32 Port_PortBaseAddress[PORT_NUMBER_OF_PORTS];
 
 /* GPIO Registers offset addresses */
 #define PORT_DATA_REG_OFFSET              0x3FC
@@ -40,6 +70,20 @@
 #define PORT_DR4R_REG_OFFSET              0x504
 #define PORT_DR8R_REG_OFFSET              0x508
 #define PORT_SLEW_RATE_CTL_REG_OFFSET     0x518
+#define PORT_INT_SENSE_REG_OFFSET         0x404
+#define PORT_INT_BOTH_EDGES_REG_OFFSET    0x408
+#define PORT_INT_EVENT_REG_OFFSET         0x40C
+#define PORT_INT_MASK_REG_OFFSET          0x410
+#define PORT_MASKED_INT_STATUS_REG_OFFSET 0x418
+#define PORT_INT_CLEAR_REG_OFFSET         0x41C
+
+/* NVIC Interrupt Set Enable register of the interrupts 0 to 31, the GPIO Ports A to E are the interrupts 0 to 4 and Port F the interrupt 30 */
+#define NVIC_EN0_REG                      (*((volatile uint32 *)0xE000E100))
+
+/* NVIC Interrupt Priority register of an interrupt, 4 interrupts per register with the 3 bits of each priority in bits 5 to 7 of its byte */
+#define NVIC_PRI_REG(IRQ)                 (*((volatile uint32 *)(0xE000E400UL + (4UL * ((uint32)(IRQ) / 4U)))))
+#define NVIC_PRI_BITS_POS(IRQ)            ((((uint32)(IRQ) % 4U) * 8U) + 5U)
+#define NVIC_PRI_MASK                     0x7UL
 
 
 #endif /* PORT_REGS_H */
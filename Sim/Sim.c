@@ -0,0 +1,1083 @@
+ /******************************************************************************
+ *
+ * Module: Sim
+ *
+ * File Name: Sim.c
+ *
+ * Description: Host register simulator of the TM4C123GH6PM GPIO, SYSCTL and SysTick blocks.
+ *
+ *              The peripheral, bit-band and private peripheral bus regions are mapped at their
+ *              datasheet addresses without any access right, so the drivers run unchanged with
+ *              their constant register addresses. Every access faults, the fault handler loads
+ *              the modelled value of the register into the page, single steps the accessing
+ *              instruction and applies the written value to the model afterwards.
+ *
+ *              Modelled behaviour:
+ *              - GPIODATA address masking (address bits 9:2 select the accessed pins)
+ *              - GPIOLOCK / GPIOCR protection of GPIOAFSEL, GPIOPUR, GPIOPDR and GPIODEN
+ *              - RCGC2 clock gate and GPIOHBCTL aperture selection (bus fault otherwise)
+ *              - Peripheral bit-band alias
+ *              - SysTick COUNTFLAG, CURRENT and interrupt, ticking in real time on SIGALRM,
+ *                ICSR PENDSTSET while a period ended without its exception
+ *              - PendSV set pending through ICSR, taken at the lowest priority and preempted by SysTick
+ *              - GPIO edge interrupts (GPIOIS/IBE/IEV/IM/RIS/MIS/ICR) of the levels driven by Sim_SetInputLevel,
+ *                taken through the NVIC EN0 enable bits before SysTick and PendSV
+ *              - DWT CYCCNT counting the 16 MHz system clock cycles of the elapsed host time
+ *
+ *              Requires Linux on x86-64 (page fault error code and trap flag single step).
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+
+#include "Sim.h"
+
+#if !defined(__linux__) || !defined(__x86_64__)
+  #error "The register simulator requires Linux on x86-64"
+#endif
+
+/* Simulated regions of the address map */
+#define SIM_PERIPH_BASE                0x40000000UL
+#define SIM_PERIPH_SIZE                0x00100000UL
+#define SIM_BIT_BAND_BASE              0x42000000UL
+#define SIM_BIT_BAND_SIZE              0x02000000UL
+#define SIM_PPB_BASE                   0xE0000000UL
+#define SIM_PPB_SIZE                   0x00100000UL
+#define SIM_PAGE_SIZE                  0x1000UL
+
+/* System Control registers */
+#define SIM_SYSCTL_BASE                0x400FE000UL
+#define SIM_SYSCTL_GPIOHBCTL_OFFSET    0x06C
+#define SIM_SYSCTL_RCGC2_OFFSET        0x108
+#define SIM_SYSCTL_RCGCGPIO_OFFSET     0x608
+#define SIM_SYSCTL_PRGPIO_OFFSET       0xA08
+
+/* GPIO registers */
+#define SIM_GPIO_DATA_END_OFFSET       0x400
+#define SIM_GPIO_DIR_OFFSET            0x400
+#define SIM_GPIO_IS_OFFSET             0x404
+#define SIM_GPIO_IBE_OFFSET            0x408
+#define SIM_GPIO_IEV_OFFSET            0x40C
+#define SIM_GPIO_IM_OFFSET             0x410
+#define SIM_GPIO_RIS_OFFSET            0x414
+#define SIM_GPIO_MIS_OFFSET            0x418
+#define SIM_GPIO_ICR_OFFSET            0x41C
+#define SIM_GPIO_AFSEL_OFFSET          0x420
+#define SIM_GPIO_PUR_OFFSET            0x510
+#define SIM_GPIO_PDR_OFFSET            0x514
+#define SIM_GPIO_DEN_OFFSET            0x51C
+#define SIM_GPIO_LOCK_OFFSET           0x520
+#define SIM_GPIO_CR_OFFSET             0x524
+#define SIM_GPIO_PCTL_OFFSET           0x52C
+#define SIM_GPIO_LOCK_KEY              0x4C4F434BUL
+
+/* SysTick registers */
+#define SIM_SYSTICK_CTRL_ADDRESS       0xE000E010UL
+#define SIM_SYSTICK_RELOAD_ADDRESS     0xE000E014UL
+#define SIM_SYSTICK_CURRENT_ADDRESS    0xE000E018UL
+#define SIM_SYSTICK_ENABLE_MASK        0x00000001UL
+#define SIM_SYSTICK_TICKINT_MASK       0x00000002UL
+#define SIM_SYSTICK_COUNTFLAG_MASK     0x00010000UL
+
+/* NVIC Interrupt Set Enable register of the interrupts 0 to 31 */
+#define SIM_NVIC_EN0_ADDRESS           0xE000E100UL
+
+/* NVIC Interrupt Priority registers and System Handler Priority 3 register (PendSV bits 23:21, SysTick bits 31:29) */
+#define SIM_NVIC_PRI0_ADDRESS          0xE000E400UL
+#define SIM_SYSPRI3_ADDRESS            0xE000ED20UL
+#define SIM_PENDSV_PRIORITY_POS        21
+#define SIM_SYSTICK_PRIORITY_POS       29
+
+/* Priority of the thread mode, below the 8 priorities of the interrupts */
+#define SIM_THREAD_PRIORITY            8U
+
+/* Interrupt Control and State Register, PendSV set and clear pending bits and SysTick pending bit */
+#define SIM_ICSR_ADDRESS               0xE000ED04UL
+#define SIM_ICSR_PENDSVSET_MASK        0x10000000UL
+#define SIM_ICSR_PENDSVCLR_MASK        0x08000000UL
+#define SIM_ICSR_PENDSTSET_MASK        0x04000000UL
+
+/* Data Watchpoint and Trace cycle counter registers */
+#define SIM_DWT_CTRL_ADDRESS           0xE0001000UL
+#define SIM_DWT_CYCCNT_ADDRESS         0xE0001004UL
+#define SIM_DWT_CYCCNTENA_MASK         0x00000001UL
+#define SIM_DEMCR_ADDRESS              0xE000EDFCUL
+#define SIM_DEMCR_TRCENA_MASK          0x01000000UL
+
+/* System clock of the simulated SysTick Timer in Hz */
+#define SIM_SYSTEM_CLOCK               16000000ULL
+
+/* x86 EFLAGS trap flag and page fault error code write bit */
+#define SIM_EFLAGS_TRAP_FLAG           0x100
+#define SIM_PAGE_FAULT_WRITE           0x2
+
+/* Kinds of modelled accesses */
+#define SIM_READ                       (0U)
+#define SIM_WRITE                      (1U)
+#define SIM_PEEK                       (2U)  /* read without side effect and without counting */
+
+/* Model of one GPIO Port */
+typedef struct
+{
+    uint32 Regs[SIM_PAGE_SIZE / 4];  /* registers other than GPIODATA, indexed by offset / 4 */
+    uint8 Data;                      /* output latch of GPIODATA */
+    uint8 Input;                     /* level driven externally on the input pins */
+    uint8 InputDriven;               /* input pins driven by Sim_SetInputLevel, the others follow the pulls */
+    uint8 Locked;                    /* GPIOLOCK state */
+}Sim_PortType;
+
+/* APB and AHB base addresses of the GPIO Ports */
+static const uint32 Sim_PortApbBase[SIM_NUMBER_OF_PORTS] =
+{
+    0x40004000UL, 0x40005000UL, 0x40006000UL, 0x40007000UL, 0x40024000UL, 0x40025000UL
+};
+static const uint32 Sim_PortAhbBase[SIM_NUMBER_OF_PORTS] =
+{
+    0x40058000UL, 0x40059000UL, 0x4005A000UL, 0x4005B000UL, 0x4005C000UL, 0x4005D000UL
+};
+
+static Sim_PortType Sim_Ports[SIM_NUMBER_OF_PORTS];
+static uint32 Sim_SysCtl[SIM_PAGE_SIZE / 4];
+static uint32 Sim_Ppb[SIM_PPB_SIZE / 4];
+
+static Sim_AccessCountType Sim_AccessCount[SIM_NUMBER_OF_BLOCKS];
+static uint32 Sim_BusFaultCount = 0;
+
+/* Access being single stepped */
+static uint8 * Sim_StepPage = NULL;
+static uint32 Sim_StepAddress = 0;
+static uint8 Sim_StepWrite = FALSE;
+static uint8 Sim_StepAlarmBlocked = FALSE;
+
+/* Interrupt state of the simulated core */
+static volatile sig_atomic_t Sim_Primask = 1;
+static volatile sig_atomic_t Sim_SysTickPending = 0;
+static volatile sig_atomic_t Sim_PendSvPending = 0;
+static volatile sig_atomic_t Sim_ActivePriority = SIM_THREAD_PRIORITY;
+static volatile uint32 Sim_TickCount = 0;
+static volatile uint32 Sim_SysTickTaken = 0;
+static uint32 Sim_RunTicks = 0;
+static struct timespec Sim_SysTickStart;
+static struct timespec Sim_CycleCountStart;
+
+/* Only linked with the Gpt Driver */
+extern void SysTick_Handler(void) __attribute__((weak));
+
+/* Only linked with a preemptive Os */
+extern void PendSV_Handler(void) __attribute__((weak));
+
+/* Only linked with the Port edge interrupts */
+extern void GPIOPortA_Handler(void) __attribute__((weak));
+extern void GPIOPortB_Handler(void) __attribute__((weak));
+extern void GPIOPortC_Handler(void) __attribute__((weak));
+extern void GPIOPortD_Handler(void) __attribute__((weak));
+extern void GPIOPortE_Handler(void) __attribute__((weak));
+extern void GPIOPortF_Handler(void) __attribute__((weak));
+
+/************************************************************************************
+* Service Name: Sim_GpioPort
+* Description: Return the GPIO Port decoded from an address and whether it is the AHB
+*              aperture, or SIM_NUMBER_OF_PORTS for an address outside the GPIO Ports.
+************************************************************************************/
+static uint8 Sim_GpioPort(uint32 Address, uint8 * Ahb)
+{
+    uint8 Port = 0;
+
+    for(Port = 0 ; Port < SIM_NUMBER_OF_PORTS ; Port++)
+    {
+        if((Address & ~(SIM_PAGE_SIZE - 1)) == Sim_PortApbBase[Port])
+        {
+            *Ahb = FALSE;
+            break;
+        }
+        else if((Address & ~(SIM_PAGE_SIZE - 1)) == Sim_PortAhbBase[Port])
+        {
+            *Ahb = TRUE;
+            break;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    return Port;
+}
+
+/************************************************************************************
+* Service Name: Sim_BusFault
+* Description: Report a bus fault, the access is discarded and reads return 0.
+************************************************************************************/
+static void Sim_BusFault(uint32 Address, const char * Reason)
+{
+    Sim_BusFaultCount++;
+    fprintf(stderr, "Sim: bus fault at 0x%08X (%s)\n", (unsigned int)Address, Reason);
+}
+
+/************************************************************************************
+* Service Name: Sim_PinLevels
+* Description: Return the levels of all the pins of a port as read through GPIODATA.
+************************************************************************************/
+static uint8 Sim_PinLevels(const Sim_PortType * Port_Ptr)
+{
+    uint8 Dir = (uint8)Port_Ptr->Regs[SIM_GPIO_DIR_OFFSET / 4];
+    uint8 Pulls = (uint8)(Port_Ptr->Regs[SIM_GPIO_PUR_OFFSET / 4] & ~Port_Ptr->Regs[SIM_GPIO_PDR_OFFSET / 4]);
+    uint8 Input = (uint8)((Port_Ptr->Input & Port_Ptr->InputDriven) | (Pulls & ~Port_Ptr->InputDriven));
+
+    return (uint8)(((Port_Ptr->Data & Dir) | (Input & ~Dir)) & Port_Ptr->Regs[SIM_GPIO_DEN_OFFSET / 4]);
+}
+
+/************************************************************************************
+* Service Name: Sim_GpioAccess
+* Description: Model one access to a GPIO Port register.
+************************************************************************************/
+static uint32 Sim_GpioAccess(uint8 Port, uint8 Ahb, uint32 Address, uint32 Value, uint8 Kind)
+{
+    Sim_PortType * Port_Ptr = &Sim_Ports[Port];
+    uint32 Offset = Address & (SIM_PAGE_SIZE - 1);
+    uint32 Clocks = (Sim_SysCtl[SIM_SYSCTL_RCGC2_OFFSET / 4] | Sim_SysCtl[SIM_SYSCTL_RCGCGPIO_OFFSET / 4]);
+    uint32 Committed = 0;
+    uint32 Result = 0;
+
+    if((Kind != SIM_PEEK) && !(Clocks & (1UL << Port)))
+    {
+        Sim_BusFault(Address, "GPIO Port clock is gated");
+    }
+    else if((Kind != SIM_PEEK) && (Ahb != ((Sim_SysCtl[SIM_SYSCTL_GPIOHBCTL_OFFSET / 4] >> Port) & 1UL)))
+    {
+        Sim_BusFault(Address, "GPIO Port is not mapped on this aperture");
+    }
+    else if(Offset < SIM_GPIO_DATA_END_OFFSET)
+    {
+        /* Address bits 9:2 are the mask of the accessed pins */
+        uint8 Mask = (uint8)(Offset >> 2);
+        if(Kind == SIM_WRITE)
+        {
+            Port_Ptr->Data = (uint8)((Port_Ptr->Data & ~Mask) | (Value & Mask));
+        }
+        else
+        {
+            Result = Sim_PinLevels(Port_Ptr) & Mask;
+        }
+    }
+    else if(Offset == SIM_GPIO_LOCK_OFFSET)
+    {
+        if(Kind == SIM_WRITE)
+        {
+            Port_Ptr->Locked = (Value != SIM_GPIO_LOCK_KEY);
+        }
+        else
+        {
+            Result = Port_Ptr->Locked;
+        }
+    }
+    else if(Kind == SIM_WRITE)
+    {
+        switch(Offset)
+        {
+            case SIM_GPIO_CR_OFFSET:
+                /* The commit register is only writable while the port is unlocked */
+                if(!Port_Ptr->Locked)
+                {
+                    Port_Ptr->Regs[Offset / 4] = Value & 0xFF;
+                }
+                break;
+            case SIM_GPIO_AFSEL_OFFSET:
+            case SIM_GPIO_PUR_OFFSET:
+            case SIM_GPIO_PDR_OFFSET:
+            case SIM_GPIO_DEN_OFFSET:
+                /* Only the committed bits of the protected registers can change */
+                Committed = Port_Ptr->Regs[SIM_GPIO_CR_OFFSET / 4];
+                Port_Ptr->Regs[Offset / 4] = (Port_Ptr->Regs[Offset / 4] & ~Committed) | (Value & Committed & 0xFF);
+                break;
+            case SIM_GPIO_RIS_OFFSET:
+            case SIM_GPIO_MIS_OFFSET:
+                /* Read only */
+                break;
+            case SIM_GPIO_ICR_OFFSET:
+                Port_Ptr->Regs[SIM_GPIO_RIS_OFFSET / 4] &= ~Value;
+                break;
+            default:
+                Port_Ptr->Regs[Offset / 4] = Value;
+                break;
+        }
+    }
+    else if(Offset == SIM_GPIO_MIS_OFFSET)
+    {
+        Result = Port_Ptr->Regs[SIM_GPIO_RIS_OFFSET / 4] & Port_Ptr->Regs[SIM_GPIO_IM_OFFSET / 4];
+    }
+    else
+    {
+        Result = Port_Ptr->Regs[Offset / 4];
+    }
+    return Result;
+}
+
+/************************************************************************************
+* Service Name: Sim_CyclesSince
+* Description: Return the number of system clock cycles of the host time elapsed since Start.
+************************************************************************************/
+static uint64 Sim_CyclesSince(const struct timespec * Start)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return ((uint64)(Now.tv_sec - Start->tv_sec) * 1000000000ULL + (uint64)Now.tv_nsec - (uint64)Start->tv_nsec)
+           * SIM_SYSTEM_CLOCK / 1000000000ULL;
+}
+
+/************************************************************************************
+* Service Name: Sim_SysTickEnded
+* Description: Return the number of SysTick periods ended since the timer start and the
+*              cycles elapsed in the current one. With the interrupt enabled the host interval
+*              timer and the host clock drift apart, so the ended periods are kept between the
+*              SysTick exceptions taken and one more pending, the CURRENT value and PENDSTSET
+*              then never contradict the exceptions seen by the program.
+************************************************************************************/
+static uint64 Sim_SysTickEnded(uint64 * Elapsed_Ptr)
+{
+    uint64 Period = (uint64)(Sim_Ppb[(SIM_SYSTICK_RELOAD_ADDRESS - SIM_PPB_BASE) / 4] & 0x00FFFFFFUL) + 1;
+    uint64 Cycles = Sim_CyclesSince(&Sim_SysTickStart);
+    uint64 Ended = Cycles / Period;
+    uint64 Taken = Sim_SysTickTaken;
+
+    if(Sim_Ppb[(SIM_SYSTICK_CTRL_ADDRESS - SIM_PPB_BASE) / 4] & SIM_SYSTICK_TICKINT_MASK)
+    {
+        if(Ended < (Taken + (Sim_SysTickPending ? 1 : 0)))
+        {
+            Ended = Taken + (Sim_SysTickPending ? 1 : 0);
+        }
+        else if(Ended > (Taken + 1))
+        {
+            Ended = Taken + 1;
+        }
+    }
+    if(Cycles < (Ended * Period))
+    {
+        *Elapsed_Ptr = 0;
+    }
+    else if((Cycles - (Ended * Period)) >= Period)
+    {
+        *Elapsed_Ptr = Period - 1;
+    }
+    else
+    {
+        *Elapsed_Ptr = Cycles - (Ended * Period);
+    }
+    return Ended;
+}
+
+/************************************************************************************
+* Service Name: Sim_SysTickCurrent
+* Description: Return the CURRENT value of the SysTick Timer from the elapsed host time.
+************************************************************************************/
+static uint32 Sim_SysTickCurrent(void)
+{
+    uint64 Elapsed = 0;
+    uint32 Reload = Sim_Ppb[(SIM_SYSTICK_RELOAD_ADDRESS - SIM_PPB_BASE) / 4] & 0x00FFFFFFUL;
+
+    if(!(Sim_Ppb[(SIM_SYSTICK_CTRL_ADDRESS - SIM_PPB_BASE) / 4] & SIM_SYSTICK_ENABLE_MASK))
+    {
+        return Sim_Ppb[(SIM_SYSTICK_CURRENT_ADDRESS - SIM_PPB_BASE) / 4];
+    }
+    (void)Sim_SysTickEnded(&Elapsed);
+    return (uint32)(Reload - Elapsed);
+}
+
+/************************************************************************************
+* Service Name: Sim_SysTickPendingBit
+* Description: Return PENDSTSET of the ICSR, set while a SysTick period ended without its exception.
+************************************************************************************/
+static uint32 Sim_SysTickPendingBit(void)
+{
+    uint64 Elapsed = 0;
+
+    if((Sim_Ppb[(SIM_SYSTICK_CTRL_ADDRESS - SIM_PPB_BASE) / 4] & (SIM_SYSTICK_ENABLE_MASK | SIM_SYSTICK_TICKINT_MASK))
+       != (SIM_SYSTICK_ENABLE_MASK | SIM_SYSTICK_TICKINT_MASK))
+    {
+        return Sim_SysTickPending ? SIM_ICSR_PENDSTSET_MASK : 0;
+    }
+    return (Sim_SysTickEnded(&Elapsed) > Sim_SysTickTaken) ? SIM_ICSR_PENDSTSET_MASK : 0;
+}
+
+/************************************************************************************
+* Service Name: Sim_CycleCount
+* Description: Return the DWT CYCCNT value, it only counts while DEMCR TRCENA and
+*              DWT CYCCNTENA are both set.
+************************************************************************************/
+static uint32 Sim_CycleCount(void)
+{
+    uint32 Result = Sim_Ppb[(SIM_DWT_CYCCNT_ADDRESS - SIM_PPB_BASE) / 4];
+
+    if((Sim_Ppb[(SIM_DEMCR_ADDRESS - SIM_PPB_BASE) / 4] & SIM_DEMCR_TRCENA_MASK)
+    && (Sim_Ppb[(SIM_DWT_CTRL_ADDRESS - SIM_PPB_BASE) / 4] & SIM_DWT_CYCCNTENA_MASK))
+    {
+        Result += (uint32)Sim_CyclesSince(&Sim_CycleCountStart);
+    }
+    return Result;
+}
+
+/************************************************************************************
+* Service Name: Sim_SysTickProgram
+* Description: Start or stop the host interval timer generating the SysTick periods.
+************************************************************************************/
+static void Sim_SysTickProgram(void)
+{
+    struct itimerval Timer;
+    uint64 Period_us = 0;
+
+    memset(&Timer, 0, sizeof(Timer));
+    if(Sim_Ppb[(SIM_SYSTICK_CTRL_ADDRESS - SIM_PPB_BASE) / 4] & SIM_SYSTICK_ENABLE_MASK)
+    {
+        Period_us = ((uint64)(Sim_Ppb[(SIM_SYSTICK_RELOAD_ADDRESS - SIM_PPB_BASE) / 4] & 0x00FFFFFFUL) + 1)
+                    * 1000000ULL / SIM_SYSTEM_CLOCK;
+        if(Period_us == 0)
+        {
+            Period_us = 1;
+        }
+        Timer.it_interval.tv_sec  = (time_t)(Period_us / 1000000ULL);
+        Timer.it_interval.tv_usec = (suseconds_t)(Period_us % 1000000ULL);
+        Timer.it_value = Timer.it_interval;
+        clock_gettime(CLOCK_MONOTONIC, &Sim_SysTickStart);
+        Sim_SysTickTaken = 0;
+    }
+    setitimer(ITIMER_REAL, &Timer, NULL);
+}
+
+/************************************************************************************
+* Service Name: Sim_PpbAccess
+* Description: Model one access to a register of the private peripheral bus.
+************************************************************************************/
+static uint32 Sim_PpbAccess(uint32 Address, uint32 Value, uint8 Kind)
+{
+    uint32 * Reg_Ptr = &Sim_Ppb[(Address - SIM_PPB_BASE) / 4];
+    uint32 Result = 0;
+
+    if(Kind == SIM_WRITE)
+    {
+        if(Address == SIM_SYSTICK_CTRL_ADDRESS)
+        {
+            /* A stopped timer keeps its CURRENT value */
+            Sim_Ppb[(SIM_SYSTICK_CURRENT_ADDRESS - SIM_PPB_BASE) / 4] = Sim_SysTickCurrent();
+            *Reg_Ptr = (*Reg_Ptr & SIM_SYSTICK_COUNTFLAG_MASK) | (Value & ~SIM_SYSTICK_COUNTFLAG_MASK);
+            Sim_SysTickProgram();
+        }
+        else if(Address == SIM_SYSTICK_CURRENT_ADDRESS)
+        {
+            /* Any write clears the counter and COUNTFLAG */
+            *Reg_Ptr = 0;
+            Sim_Ppb[(SIM_SYSTICK_CTRL_ADDRESS - SIM_PPB_BASE) / 4] &= ~SIM_SYSTICK_COUNTFLAG_MASK;
+        }
+        else if(Address == SIM_NVIC_EN0_ADDRESS)
+        {
+            /* Writing 0 has no effect */
+            *Reg_Ptr |= Value;
+        }
+        else if(Address == SIM_ICSR_ADDRESS)
+        {
+            if(Value & SIM_ICSR_PENDSVSET_MASK)
+            {
+                Sim_PendSvPending = 1;
+            }
+            else if(Value & SIM_ICSR_PENDSVCLR_MASK)
+            {
+                Sim_PendSvPending = 0;
+            }
+            else
+            {
+                /* No Action Required ... other ICSR bits are not modelled */
+            }
+        }
+        else if((Address == SIM_DWT_CTRL_ADDRESS) || (Address == SIM_DEMCR_ADDRESS) || (Address == SIM_DWT_CYCCNT_ADDRESS))
+        {
+            /* Freeze the cycle counter, apply the write and restart counting from the frozen value */
+            Sim_Ppb[(SIM_DWT_CYCCNT_ADDRESS - SIM_PPB_BASE) / 4] = Sim_CycleCount();
+            *Reg_Ptr = Value;
+            clock_gettime(CLOCK_MONOTONIC, &Sim_CycleCountStart);
+        }
+        else
+        {
+            *Reg_Ptr = Value;
+        }
+    }
+    else if(Address == SIM_SYSTICK_CURRENT_ADDRESS)
+    {
+        Result = Sim_SysTickCurrent();
+    }
+    else if(Address == SIM_DWT_CYCCNT_ADDRESS)
+    {
+        Result = Sim_CycleCount();
+    }
+    else if(Address == SIM_ICSR_ADDRESS)
+    {
+        Result = (Sim_PendSvPending ? SIM_ICSR_PENDSVSET_MASK : 0) | Sim_SysTickPendingBit();
+    }
+    else
+    {
+        Result = *Reg_Ptr;
+        if((Address == SIM_SYSTICK_CTRL_ADDRESS) && (Kind == SIM_READ))
+        {
+            /* COUNTFLAG is cleared by reading it */
+            *Reg_Ptr &= ~SIM_SYSTICK_COUNTFLAG_MASK;
+        }
+    }
+    return Result;
+}
+
+/************************************************************************************
+* Service Name: Sim_RegAccess
+* Description: Model one word access to a simulated address and return the block it belongs to.
+************************************************************************************/
+static uint32 Sim_RegAccess(uint32 Address, uint32 Value, uint8 Kind, uint8 * Block)
+{
+    uint8 Port = 0;
+    uint8 Ahb = FALSE;
+    uint32 Target = 0;
+    uint32 Bit = 0;
+    uint32 Result = 0;
+
+    *Block = SIM_NUMBER_OF_BLOCKS;
+    if((Address >= SIM_BIT_BAND_BASE) && (Address < (SIM_BIT_BAND_BASE + SIM_BIT_BAND_SIZE)))
+    {
+        /* Bit-band alias: one word per bit of the peripheral region, a write is a read-modify-write of the bus */
+        Target = SIM_PERIPH_BASE + (((Address - SIM_BIT_BAND_BASE) >> 5) & ~3UL);
+        Bit = ((Address - SIM_BIT_BAND_BASE) >> 2) & 0x1FUL;
+        Result = Sim_RegAccess(Target, 0, (Kind == SIM_PEEK) ? SIM_PEEK : SIM_READ, Block);
+        if(Kind == SIM_WRITE)
+        {
+            Result = (Value & 1UL) ? (Result | (1UL << Bit)) : (Result & ~(1UL << Bit));
+            (void)Sim_RegAccess(Target, Result, SIM_WRITE, Block);
+        }
+        Result = (Result >> Bit) & 1UL;
+    }
+    else if((Address >= SIM_PPB_BASE) && (Address < (SIM_PPB_BASE + SIM_PPB_SIZE)))
+    {
+        Result = Sim_PpbAccess(Address, Value, Kind);
+        *Block = SIM_BLOCK_PPB;
+    }
+    else if((Address & ~(SIM_PAGE_SIZE - 1)) == SIM_SYSCTL_BASE)
+    {
+        if(Kind == SIM_WRITE)
+        {
+            Sim_SysCtl[(Address - SIM_SYSCTL_BASE) / 4] = Value;
+        }
+        else if((Address - SIM_SYSCTL_BASE) == SIM_SYSCTL_PRGPIO_OFFSET)
+        {
+            /* The ports are ready as soon as their clock is enabled */
+            Result = (Sim_SysCtl[SIM_SYSCTL_RCGC2_OFFSET / 4] | Sim_SysCtl[SIM_SYSCTL_RCGCGPIO_OFFSET / 4]) & 0x3FUL;
+        }
+        else
+        {
+            Result = Sim_SysCtl[(Address - SIM_SYSCTL_BASE) / 4];
+        }
+        *Block = SIM_BLOCK_SYSCTL;
+    }
+    else if((Port = Sim_GpioPort(Address, &Ahb)) < SIM_NUMBER_OF_PORTS)
+    {
+        Result = Sim_GpioAccess(Port, Ahb, Address, Value, Kind);
+        *Block = SIM_BLOCK_GPIO;
+    }
+    else if(Kind != SIM_PEEK)
+    {
+        Sim_BusFault(Address, "no simulated peripheral");
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return Result;
+}
+
+/************************************************************************************
+* Service Name: Sim_Access
+* Description: Model one word access of the software and count it on its block.
+************************************************************************************/
+static uint32 Sim_Access(uint32 Address, uint32 Value, uint8 Kind)
+{
+    uint8 Block = SIM_NUMBER_OF_BLOCKS;
+    uint32 Result = Sim_RegAccess(Address, Value, Kind, &Block);
+
+    if((Block < SIM_NUMBER_OF_BLOCKS) && (Kind == SIM_READ))
+    {
+        Sim_AccessCount[Block].Reads++;
+    }
+    else if((Block < SIM_NUMBER_OF_BLOCKS) && (Kind == SIM_WRITE))
+    {
+        Sim_AccessCount[Block].Writes++;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return Result;
+}
+
+/************************************************************************************
+* Service Name: Sim_Report
+* Description: Print the access counters and the pin levels of the used ports.
+************************************************************************************/
+static void Sim_Report(void)
+{
+    static const char * const Block_Names[SIM_NUMBER_OF_BLOCKS] = {"GPIO", "SYSCTL", "PPB"};
+    uint8 Block = 0;
+    uint8 Port = 0;
+
+    fprintf(stderr, "Sim: %u SysTick periods, %u bus faults\n",
+            (unsigned int)Sim_TickCount, (unsigned int)Sim_BusFaultCount);
+    for(Block = 0 ; Block < SIM_NUMBER_OF_BLOCKS ; Block++)
+    {
+        fprintf(stderr, "Sim: %-6s reads %10u writes %10u\n", Block_Names[Block],
+                (unsigned int)Sim_AccessCount[Block].Reads, (unsigned int)Sim_AccessCount[Block].Writes);
+    }
+    for(Port = 0 ; Port < SIM_NUMBER_OF_PORTS ; Port++)
+    {
+        if(Sim_Ports[Port].Regs[SIM_GPIO_DEN_OFFSET / 4] != 0)
+        {
+            fprintf(stderr, "Sim: PORT%c DIR 0x%02X DEN 0x%02X PINS 0x%02X\n", 'A' + Port,
+                    (unsigned int)(Sim_Ports[Port].Regs[SIM_GPIO_DIR_OFFSET / 4] & 0xFF),
+                    (unsigned int)(Sim_Ports[Port].Regs[SIM_GPIO_DEN_OFFSET / 4] & 0xFF),
+                    (unsigned int)Sim_PinLevels(&Sim_Ports[Port]));
+        }
+    }
+}
+
+/************************************************************************************
+* Service Name: Sim_Exit
+* Description: Print the report at the exit of the program and fail the exit status
+*              if any bus fault was simulated, whatever main returned.
+************************************************************************************/
+static void Sim_Exit(void)
+{
+    Sim_Report();
+    if(Sim_BusFaultCount != 0)
+    {
+        fflush(NULL);
+        _exit(EXIT_FAILURE);
+    }
+}
+
+/************************************************************************************
+* Service Name: Sim_TakeInterrupts
+* Description: Enter the pending interrupts that are not masked, by the priorities set in the
+*              NVIC and System Handler Priority registers: an interrupt is only entered above
+*              the active priority and equal priorities are taken by exception number (PendSV,
+*              SysTick, then the GPIO Ports). The SysTick periods are blocked while an interrupt
+*              is chosen, and unblocked while a handler below the SysTick priority runs so
+*              SysTick preempts it. An interrupt pended by a handler is taken once it returns.
+************************************************************************************/
+static void Sim_TakeInterrupts(void)
+{
+    static void (* const Gpio_Handlers[SIM_NUMBER_OF_PORTS])(void) =
+    {
+        GPIOPortA_Handler, GPIOPortB_Handler, GPIOPortC_Handler, GPIOPortD_Handler, GPIOPortE_Handler, GPIOPortF_Handler
+    };
+    static const uint8 Gpio_Irqs[SIM_NUMBER_OF_PORTS] = {0, 1, 2, 3, 4, 30};
+    const uint32 * Syspri3_Ptr = &Sim_Ppb[(SIM_SYSPRI3_ADDRESS - SIM_PPB_BASE) / 4];
+    sigset_t Alarm_Mask;
+    sigset_t Old_Mask;
+    sig_atomic_t Old_Priority = 0;
+    uint32 Priority = 0;
+    uint32 SysTick_Priority = 0;
+    uint32 Best_Priority = 0;
+    sint32 Best = 0;    /* -2 PendSV, -1 SysTick, else the GPIO Port, SIM_NUMBER_OF_PORTS for none */
+    uint8 Port = 0;
+
+    if(Sim_Primask)
+    {
+        return;
+    }
+    sigemptyset(&Alarm_Mask);
+    sigaddset(&Alarm_Mask, SIGALRM);
+    sigprocmask(SIG_BLOCK, &Alarm_Mask, &Old_Mask);
+
+    do
+    {
+        SysTick_Priority = (*Syspri3_Ptr >> SIM_SYSTICK_PRIORITY_POS) & 7U;
+        Best = SIM_NUMBER_OF_PORTS;
+        Best_Priority = (uint32)Sim_ActivePriority;
+
+        Priority = (*Syspri3_Ptr >> SIM_PENDSV_PRIORITY_POS) & 7U;
+        if(Sim_PendSvPending && (PendSV_Handler != NULL) && (Priority < Best_Priority))
+        {
+            Best = -2;
+            Best_Priority = Priority;
+        }
+        if(Sim_SysTickPending && (SysTick_Handler != NULL) && (SysTick_Priority < Best_Priority))
+        {
+            Best = -1;
+            Best_Priority = SysTick_Priority;
+        }
+        for(Port = 0 ; Port < SIM_NUMBER_OF_PORTS ; Port++)
+        {
+            Priority = (Sim_Ppb[((SIM_NVIC_PRI0_ADDRESS - SIM_PPB_BASE) / 4) + (Gpio_Irqs[Port] / 4)]
+                        >> (((Gpio_Irqs[Port] % 4) * 8) + 5)) & 7U;
+            if((Sim_Ports[Port].Regs[SIM_GPIO_RIS_OFFSET / 4] & Sim_Ports[Port].Regs[SIM_GPIO_IM_OFFSET / 4])
+               && (Sim_Ppb[(SIM_NVIC_EN0_ADDRESS - SIM_PPB_BASE) / 4] & (1UL << Gpio_Irqs[Port]))
+               && (Gpio_Handlers[Port] != NULL) && (Priority < Best_Priority))
+            {
+                Best = Port;
+                Best_Priority = Priority;
+            }
+        }
+
+        if(Best != SIM_NUMBER_OF_PORTS)
+        {
+            Old_Priority = Sim_ActivePriority;
+            Sim_ActivePriority = (sig_atomic_t)Best_Priority;
+            if(Best == -1)
+            {
+                Sim_SysTickTaken++;
+                Sim_SysTickPending = 0;
+            }
+            else if(Best == -2)
+            {
+                Sim_PendSvPending = 0;
+            }
+            else
+            {
+                /* No Action Required ... the GPIO Port ISR clears its interrupt */
+            }
+            if(Best_Priority > SysTick_Priority)
+            {
+                sigprocmask(SIG_UNBLOCK, &Alarm_Mask, NULL);
+            }
+
+            if(Best == -1)
+            {
+                SysTick_Handler();
+            }
+            else if(Best == -2)
+            {
+                PendSV_Handler();
+            }
+            else
+            {
+                Gpio_Handlers[Best]();
+            }
+
+            sigprocmask(SIG_BLOCK, &Alarm_Mask, NULL);
+            Sim_ActivePriority = Old_Priority;
+        }
+    } while((Best != SIM_NUMBER_OF_PORTS) && !Sim_Primask);
+
+    sigprocmask(SIG_SETMASK, &Old_Mask, NULL);
+}
+
+/************************************************************************************
+* Service Name: Sim_AlarmHandler
+* Description: End of one SysTick period.
+************************************************************************************/
+static void Sim_AlarmHandler(int Signal)
+{
+    uint32 * Ctrl_Ptr = &Sim_Ppb[(SIM_SYSTICK_CTRL_ADDRESS - SIM_PPB_BASE) / 4];
+
+    (void)Signal;
+    Sim_TickCount++;
+    *Ctrl_Ptr |= SIM_SYSTICK_COUNTFLAG_MASK;
+    if(*Ctrl_Ptr & SIM_SYSTICK_TICKINT_MASK)
+    {
+        Sim_SysTickPending = 1;
+        Sim_TakeInterrupts();
+    }
+    if((Sim_RunTicks != 0) && (Sim_TickCount >= Sim_RunTicks))
+    {
+        Sim_Report();
+        _exit((Sim_BusFaultCount == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+}
+
+/************************************************************************************
+* Service Name: Sim_FaultHandler
+* Description: First half of a simulated access: load the modelled register value into
+*              the page and single step the accessing instruction.
+************************************************************************************/
+static void Sim_FaultHandler(int Signal, siginfo_t * Info, void * Context)
+{
+    ucontext_t * Uc = (ucontext_t *)Context;
+    uintptr_t Address = (uintptr_t)Info->si_addr;
+
+    (void)Signal;
+    if(!(((Address >= SIM_PERIPH_BASE) && (Address < (SIM_PERIPH_BASE + SIM_PERIPH_SIZE)))
+      || ((Address >= SIM_BIT_BAND_BASE) && (Address < (SIM_BIT_BAND_BASE + SIM_BIT_BAND_SIZE)))
+      || ((Address >= SIM_PPB_BASE) && (Address < (SIM_PPB_BASE + SIM_PPB_SIZE)))))
+    {
+        /* A real crash of the program */
+        signal(SIGSEGV, SIG_DFL);
+        return;
+    }
+
+    Sim_StepAddress = (uint32)(Address & ~(uintptr_t)3);
+    Sim_StepWrite = (Uc->uc_mcontext.gregs[REG_ERR] & SIM_PAGE_FAULT_WRITE) ? TRUE : FALSE;
+    Sim_StepPage = (uint8 *)(Address & ~(uintptr_t)(SIM_PAGE_SIZE - 1));
+
+    mprotect(Sim_StepPage, SIM_PAGE_SIZE, PROT_READ | PROT_WRITE);
+    *(volatile uint32 *)(uintptr_t)Sim_StepAddress = Sim_Access(Sim_StepAddress, 0, Sim_StepWrite ? SIM_PEEK : SIM_READ);
+
+    /* No SysTick period may run while the page is open */
+    Sim_StepAlarmBlocked = sigismember(&Uc->uc_sigmask, SIGALRM) ? TRUE : FALSE;
+    sigaddset(&Uc->uc_sigmask, SIGALRM);
+    Uc->uc_mcontext.gregs[REG_EFL] |= SIM_EFLAGS_TRAP_FLAG;
+}
+
+/************************************************************************************
+* Service Name: Sim_TrapHandler
+* Description: Second half of a simulated access: apply the written value to the model
+*              and close the page again.
+************************************************************************************/
+static void Sim_TrapHandler(int Signal, siginfo_t * Info, void * Context)
+{
+    ucontext_t * Uc = (ucontext_t *)Context;
+
+    (void)Signal;
+    (void)Info;
+    if(Sim_StepPage != NULL)
+    {
+        Uc->uc_mcontext.gregs[REG_EFL] &= ~SIM_EFLAGS_TRAP_FLAG;
+        if(Sim_StepWrite)
+        {
+            (void)Sim_Access(Sim_StepAddress, *(volatile uint32 *)(uintptr_t)Sim_StepAddress, SIM_WRITE);
+        }
+        mprotect(Sim_StepPage, SIM_PAGE_SIZE, PROT_NONE);
+        Sim_StepPage = NULL;
+        if(!Sim_StepAlarmBlocked)
+        {
+            sigdelset(&Uc->uc_sigmask, SIGALRM);
+        }
+    }
+}
+
+/************************************************************************************
+* Service Name: Sim_MapRegion
+* Description: Map a simulated region at its datasheet address without access rights.
+************************************************************************************/
+static void Sim_MapRegion(uintptr_t Base, size_t Size)
+{
+    void * Region = mmap((void *)Base, Size, PROT_NONE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED_NOREPLACE, -1, 0);
+    if(Region != (void *)Base)
+    {
+        fprintf(stderr, "Sim: can not map the region at 0x%08lX\n", (unsigned long)Base);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/************************************************************************************
+* Service Name: Sim_Init
+* Description: Reset the model and install the simulator before main is called.
+*              SIM_RUN_TICKS in the environment ends the program after that many
+*              SysTick periods, printing the access counters. The exit status is
+*              non-zero if any bus fault was simulated.
+************************************************************************************/
+__attribute__((constructor)) static void Sim_Init(void)
+{
+    struct sigaction Action;
+    const char * Run_Ticks = getenv("SIM_RUN_TICKS");
+    uint8 Port = 0;
+
+    Sim_MapRegion(SIM_PERIPH_BASE, SIM_PERIPH_SIZE);
+    Sim_MapRegion(SIM_BIT_BAND_BASE, SIM_BIT_BAND_SIZE);
+    Sim_MapRegion(SIM_PPB_BASE, SIM_PPB_SIZE);
+
+    /* Reset values: all the ports locked, PD7 and PF0 uncommitted, PC0-PC3 used by JTAG */
+    for(Port = 0 ; Port < SIM_NUMBER_OF_PORTS ; Port++)
+    {
+        Sim_Ports[Port].Locked = TRUE;
+        Sim_Ports[Port].Regs[SIM_GPIO_CR_OFFSET / 4] = 0xFF;
+    }
+    Sim_Ports[2].Regs[SIM_GPIO_CR_OFFSET / 4] = 0xF0;
+    Sim_Ports[2].Regs[SIM_GPIO_AFSEL_OFFSET / 4] = 0x0F;
+    Sim_Ports[2].Regs[SIM_GPIO_DEN_OFFSET / 4] = 0x0F;
+    Sim_Ports[2].Regs[SIM_GPIO_PUR_OFFSET / 4] = 0x0F;
+    Sim_Ports[2].Regs[SIM_GPIO_PCTL_OFFSET / 4] = 0x00001111UL;
+    Sim_Ports[3].Regs[SIM_GPIO_CR_OFFSET / 4] = 0x7F;
+    Sim_Ports[5].Regs[SIM_GPIO_CR_OFFSET / 4] = 0xFE;
+
+    /* No SysTick period may run inside the two halves of an access, it would access registers itself */
+    memset(&Action, 0, sizeof(Action));
+    sigemptyset(&Action.sa_mask);
+    sigaddset(&Action.sa_mask, SIGALRM);
+    Action.sa_sigaction = Sim_FaultHandler;
+    Action.sa_flags = SA_SIGINFO;
+    sigaction(SIGSEGV, &Action, NULL);
+    Action.sa_sigaction = Sim_TrapHandler;
+    sigaction(SIGTRAP, &Action, NULL);
+    memset(&Action, 0, sizeof(Action));
+    Action.sa_handler = Sim_AlarmHandler;
+    Action.sa_flags = SA_RESTART;
+    sigaction(SIGALRM, &Action, NULL);
+
+    if(Run_Ticks != NULL)
+    {
+        Sim_RunTicks = (uint32)strtoul(Run_Ticks, NULL, 0);
+    }
+    atexit(Sim_Exit);
+}
+
+/************************************************************************************
+* Service Name: Sim_Asm
+* Description: Execute the Cortex-M instruction of an inline assembly statement.
+************************************************************************************/
+void Sim_Asm(const char * Instruction)
+{
+    sigset_t Wait_Mask;
+    sigset_t Old_Mask;
+
+    if(strcmp(Instruction, "CPSIE I") == 0)
+    {
+        Sim_Primask = 0;
+        Sim_TakeInterrupts();
+    }
+    else if(strcmp(Instruction, "CPSID I") == 0)
+    {
+        Sim_Primask = 1;
+    }
+    else if(strcmp(Instruction, "WFI") == 0)
+    {
+        /* Sleep until the next SysTick period unless an interrupt is already pending,
+         * the period is blocked while checking so it can not end between the check and the sleep */
+        sigemptyset(&Wait_Mask);
+        sigaddset(&Wait_Mask, SIGALRM);
+        sigprocmask(SIG_BLOCK, &Wait_Mask, &Old_Mask);
+        if(!Sim_SysTickPending)
+        {
+            Wait_Mask = Old_Mask;
+            sigdelset(&Wait_Mask, SIGALRM);
+            sigsuspend(&Wait_Mask);
+        }
+        sigprocmask(SIG_SETMASK, &Old_Mask, NULL);
+    }
+    else
+    {
+        /* No Action Required ... barriers and no operation */
+    }
+}
+
+/************************************************************************************
+* Service Name: Sim_GetPrimask
+* Description: Return the PRIMASK.
+************************************************************************************/
+uint32 Sim_GetPrimask(void)
+{
+    return (uint32)Sim_Primask;
+}
+
+/************************************************************************************
+* Service Name: Sim_SetPrimask
+* Description: Set the PRIMASK, as MSR PRIMASK only its bit 0 is used.
+************************************************************************************/
+void Sim_SetPrimask(uint32 Primask)
+{
+    if((Primask & 1U) == 0U)
+    {
+        Sim_Primask = 0;
+        Sim_TakeInterrupts();
+    }
+    else
+    {
+        Sim_Primask = 1;
+    }
+}
+
+/************************************************************************************
+* Service Name: Sim_SetInputLevel
+* Description: Drive the external level of an input pin.
+************************************************************************************/
+void Sim_SetInputLevel(uint8 Port, uint8 Pin, uint8 Level)
+{
+    Sim_PortType * Port_Ptr = NULL;
+    uint8 Old_Levels = 0;
+    uint8 New_Levels = 0;
+    uint8 Edges = 0;
+
+    if((Port < SIM_NUMBER_OF_PORTS) && (Pin < 8))
+    {
+        Port_Ptr = &Sim_Ports[Port];
+        Old_Levels = Sim_PinLevels(Port_Ptr);
+        Port_Ptr->InputDriven |= (uint8)(1U << Pin);
+        if(Level == STD_HIGH)
+        {
+            Port_Ptr->Input |= (uint8)(1U << Pin);
+        }
+        else
+        {
+            Port_Ptr->Input &= (uint8)~(1U << Pin);
+        }
+        New_Levels = Sim_PinLevels(Port_Ptr);
+
+        /* Edge sensitive pins: both edges, or the rising / falling edge selected by GPIOIEV */
+        Edges = (uint8)((Old_Levels ^ New_Levels) & ~Port_Ptr->Regs[SIM_GPIO_IS_OFFSET / 4]);
+        Edges &= (uint8)(Port_Ptr->Regs[SIM_GPIO_IBE_OFFSET / 4]
+                       | (New_Levels & Port_Ptr->Regs[SIM_GPIO_IEV_OFFSET / 4])
+                       | (~New_Levels & ~Port_Ptr->Regs[SIM_GPIO_IEV_OFFSET / 4]));
+        if(Edges != 0)
+        {
+            Port_Ptr->Regs[SIM_GPIO_RIS_OFFSET / 4] |= Edges;
+            Sim_TakeInterrupts();
+        }
+    }
+}
+
+/************************************************************************************
+* Service Name: Sim_GetPinLevel
+* Description: Return the level the simulated pin drives or reads.
+************************************************************************************/
+uint8 Sim_GetPinLevel(uint8 Port, uint8 Pin)
+{
+    uint8 Level = STD_LOW;
+
+    if((Port < SIM_NUMBER_OF_PORTS) && (Pin < 8))
+    {
+        Level = (uint8)((Sim_PinLevels(&Sim_Ports[Port]) >> Pin) & 1U);
+    }
+    return Level;
+}
+
+/************************************************************************************
+* Service Name: Sim_GetAccessCount
+* Description: Copy the bus access counters of a block.
+************************************************************************************/
+void Sim_GetAccessCount(uint8 Block, Sim_AccessCountType * Count)
+{
+    if((Block < SIM_NUMBER_OF_BLOCKS) && (Count != NULL))
+    {
+        *Count = Sim_AccessCount[Block];
+    }
+}
+
+/************************************************************************************
+* Service Name: Sim_ResetAccessCount
+* Description: Clear the bus access counters of all the blocks.
+************************************************************************************/
+void Sim_ResetAccessCount(void)
+{
+    memset(Sim_AccessCount, 0, sizeof(Sim_AccessCount));
+}
+
+/************************************************************************************
+* Service Name: Sim_GetBusFaultCount
+* Description: Return the number of bus faults.
+************************************************************************************/
+uint32 Sim_GetBusFaultCount(void)
+{
+    return Sim_BusFaultCount;
+}
+
+/************************************************************************************
+* Service Name: Sim_GetTickCount
+* Description: Return the number of elapsed SysTick periods.
+************************************************************************************/
+uint32 Sim_GetTickCount(void)
+{
+    return Sim_TickCount;
+}
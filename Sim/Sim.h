@@ -0,0 +1,66 @@
+ /******************************************************************************
+ *
+ * Module: Sim
+ *
+ * File Name: Sim.h
+ *
+ * Description: Header file for the host register simulator of the TM4C123GH6PM
+ *              GPIO, SYSCTL and SysTick blocks used to run the drivers on Linux.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef SIM_H
+#define SIM_H
+
+#include "Std_Types.h"
+
+/* Blocks of the simulated address map, used to index the access counters */
+#define SIM_BLOCK_GPIO                 (0U)   /* GPIO Ports A..F on the APB and AHB apertures */
+#define SIM_BLOCK_SYSCTL               (1U)   /* System Control */
+#define SIM_BLOCK_PPB                  (2U)   /* SysTick, NVIC and SCB on the private peripheral bus */
+#define SIM_NUMBER_OF_BLOCKS           (3U)
+
+/* Number of the simulated GPIO Ports */
+#define SIM_NUMBER_OF_PORTS            (6U)
+
+/* Structure to hold the bus accesses done by the software on one block */
+typedef struct
+{
+    uint32 Reads;
+    uint32 Writes;
+}Sim_AccessCountType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Description: Execute the Cortex-M instruction of an inline assembly statement (CPSIE I, CPSID I, WFI) */
+void Sim_Asm(const char * Instruction);
+
+/* Description: Return the PRIMASK, 1 while the interrupts are disabled (__get_PRIMASK of intrinsics.h) */
+uint32 Sim_GetPrimask(void);
+
+/* Description: Set the PRIMASK, the pending interrupts are taken when it is cleared (__set_PRIMASK of intrinsics.h) */
+void Sim_SetPrimask(uint32 Primask);
+
+/* Description: Drive the external level of an input pin, used for the pins configured as input,
+ * the edge interrupts of the pin are taken before returning */
+void Sim_SetInputLevel(uint8 Port, uint8 Pin, uint8 Level);
+
+/* Description: Return the level the simulated pin drives or reads */
+uint8 Sim_GetPinLevel(uint8 Port, uint8 Pin);
+
+/* Description: Copy the bus access counters of a block */
+void Sim_GetAccessCount(uint8 Block, Sim_AccessCountType * Count);
+
+/* Description: Clear the bus access counters of all the blocks */
+void Sim_ResetAccessCount(void);
+
+/* Description: Return the number of bus faults (gated clock, wrong aperture, unmapped address) */
+uint32 Sim_GetBusFaultCount(void);
+
+/* Description: Return the number of SysTick periods elapsed since the SysTick Timer was enabled */
+uint32 Sim_GetTickCount(void);
+
+#endif /* SIM_H */
@@ -0,0 +1,21 @@
+ /******************************************************************************
+ *
+ * Module: Sim
+ *
+ * File Name: Sim_Host.h
+ *
+ * Description: Header forced into every driver file of the host build (gcc -include),
+ *              it routes the Cortex-M inline assembly statements to the simulator.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef SIM_HOST_H
+#define SIM_HOST_H
+
+#include "Sim.h"
+
+/* Cortex-M instructions can not be assembled for the host, the simulator executes them instead */
+#define __asm(INSTRUCTION)    Sim_Asm(INSTRUCTION)
+
+#endif /* SIM_HOST_H */
@@ -0,0 +1,25 @@
+ /******************************************************************************
+ *
+ * Module: Sim
+ *
+ * File Name: intrinsics.h
+ *
+ * Description: Host replacement of the intrinsics.h header of the IAR compiler, found
+ *              first through -ISim. The intrinsic functions used by the drivers are run
+ *              by the simulator.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef INTRINSICS_H
+#define INTRINSICS_H
+
+#include "Sim.h"
+
+/* MRS Rd, PRIMASK */
+#define __get_PRIMASK()            Sim_GetPrimask()
+
+/* MSR PRIMASK, Rn */
+#define __set_PRIMASK(PRIMASK)     Sim_SetPrimask(PRIMASK)
+
+#endif /* INTRINSICS_H */
@@ -0,0 +1,27 @@
+ /******************************************************************************
+ *
+ * Module: Sim
+ *
+ * File Name: tm4c123gh6pm_registers.h
+ *
+ * Description: Host build replacement of the TM4C123GH6PM register definitions header,
+ *              it only defines the registers used by the drivers at their datasheet addresses.
+ *              The target build keeps using the header of the toolchain project.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef TM4C123GH6PM_REGISTERS_H
+#define TM4C123GH6PM_REGISTERS_H
+
+#include "Std_Types.h"
+
+/* SysTick Timer Registers */
+#define SYSTICK_CTRL_REG          (*((volatile uint32 *)0xE000E010))
+#define SYSTICK_RELOAD_REG        (*((volatile uint32 *)0xE000E014))
+#define SYSTICK_CURRENT_REG       (*((volatile uint32 *)0xE000E018))
+
+/* System Handler Priority Registers */
+#define NVIC_SYSTEM_PRI3_REG      (*((volatile uint32 *)0xE000ED20))
+
+#endif /* TM4C123GH6PM_REGISTERS_H */
@@ -0,0 +1,48 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test.h
+ *
+ * Description: Checks of the host tests run against the register simulator (Sim/).
+ *              Each test is a program replacing main.c in the build, it prints the failed
+ *              checks and returns a non-zero exit status if any check failed.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef TEST_H
+#define TEST_H
+
+#include <stdio.h>
+
+#include "Std_Types.h"
+#include "Sim.h"
+
+/* Number of the failed checks, each test is a single source file including this header once */
+static uint32 Test_Failures = 0;
+
+/* Check a condition, a failed check is printed with its location and counted */
+#define TEST_CHECK(COND)                                                        \
+    do                                                                          \
+    {                                                                           \
+        if(!(COND))                                                             \
+        {                                                                       \
+            Test_Failures++;                                                    \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #COND);     \
+        }                                                                       \
+    } while(0)
+
+/* Description: Print the result of the test and return the exit status of main, a bus fault fails the test */
+static int Test_Result(const char * Name)
+{
+    if(Sim_GetBusFaultCount() != 0)
+    {
+        printf("%s: %u bus faults\n", Name, (unsigned int)Sim_GetBusFaultCount());
+        Test_Failures++;
+    }
+    printf("%s: %s\n", Name, (Test_Failures == 0) ? "PASS" : "FAIL");
+    return (Test_Failures == 0) ? 0 : 1;
+}
+
+#endif /* TEST_H */
@@ -0,0 +1,91 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Button.c
+ *
+ * Description: Host test of the button to led path: presses of SW1 with contact bounce
+ *              are driven on PF4 with Sim_SetInputLevel, the GPIO Port ISR takes the edges
+ *              and the Os tasks are run tick by tick. Each press shall toggle the led once,
+ *              each release shall leave it unchanged and no event shall be lost.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "App.h"
+#include "Button.h"
+#include "Led.h"
+#include "Dio.h"
+#include "Event.h"
+#include "Test.h"
+
+/* Number of the presses of the test */
+#define TEST_PRESSES             (10U)
+
+/* Edges of the contact bounce of each press and release, odd so the last edge reaches the new level,
+ * more than the length of the event queues as only the first edge of each press and release is posted */
+#define TEST_BOUNCE_EDGES        (31U)
+
+/* Os ticks the switch is held after each press and release, at least the debounce time and one App_Task period */
+#define TEST_HOLD_TICKS          (8U)
+
+/* Os ticks counted by Test_RunTicks, App_Task runs every 3 ticks as in the task table */
+static uint32 Test_Tick = 0;
+
+/*********************************************************************************************/
+/* Description: Bounce SW1 from its current level to the given level, each edge taken by the GPIO Port ISR */
+static void Test_Bounce(uint8 Level)
+{
+    uint32 Edge = 0;
+
+    for(Edge = 0 ; Edge < TEST_BOUNCE_EDGES ; Edge++)
+    {
+        Sim_SetInputLevel(BUTTON_PORT, BUTTON_PIN_NUM, ((TEST_BOUNCE_EDGES - 1U - Edge) % 2U == 0U) ? Level : (uint8)!Level);
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Run the Os tasks for the given number of ticks */
+static void Test_RunTicks(uint32 Ticks)
+{
+    for( ; Ticks != 0U ; Ticks--)
+    {
+        Test_Tick++;
+        Button_Task();
+        if((Test_Tick % 3U) == 0U)
+        {
+            App_Task();
+        }
+    }
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    uint32 Press = 0;
+    uint8 Led_Level = STD_LOW;
+
+    Init_Task();
+
+    /* The GPIO Port ISRs are only taken with the interrupts enabled */
+    __asm("CPSIE I");
+    Test_RunTicks(TEST_HOLD_TICKS);
+    Led_Level = Sim_GetPinLevel(LED_PORT, LED_PIN_NUM);
+
+    for(Press = 0 ; Press < TEST_PRESSES ; Press++)
+    {
+        Test_Bounce(BUTTON_PRESSED);
+        Test_RunTicks(TEST_HOLD_TICKS);
+        Led_Level = (uint8)!Led_Level;
+        TEST_CHECK(BUTTON_getState() == BUTTON_PRESSED);
+        TEST_CHECK(Sim_GetPinLevel(LED_PORT, LED_PIN_NUM) == Led_Level);
+
+        Test_Bounce(BUTTON_RELEASED);
+        Test_RunTicks(TEST_HOLD_TICKS);
+        TEST_CHECK(BUTTON_getState() == BUTTON_RELEASED);
+        TEST_CHECK(Sim_GetPinLevel(LED_PORT, LED_PIN_NUM) == Led_Level);
+    }
+    TEST_CHECK(Event_GetLostCount() == 0U);
+
+    return Test_Result("Test_Button");
+}
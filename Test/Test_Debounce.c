@@ -0,0 +1,108 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Debounce.c
+ *
+ * Description: Host test of the vertical counter debouncer against a scalar reference:
+ *              random samples of the 8 pins of PORTA are driven with Sim_SetInputLevel
+ *              and the debounced levels and changes of Debounce_MainFunction shall be the
+ *              ones of a per-pin counter of DEBOUNCE_SAMPLES consecutive samples.
+ *              The test replaces the port table of Debounce_Lcfg.c.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Port.h"
+#include "Dio.h"
+#include "Debounce.h"
+#include "Test.h"
+
+/* Number of the random samples of the test */
+#define TEST_SAMPLES             (200000UL)
+
+/* Debounced port, all its pins are configured as inputs */
+#define TEST_PORT                (0U)   /* PORTA */
+
+/* Port table of the test: all the pins of PORTA */
+const Debounce_PortConfigType Debounce_Ports[DEBOUNCE_NUMBER_OF_PORTS] =
+{
+    {TEST_PORT, 0xFFU}
+};
+
+/* Scalar reference of each pin: debounced level and consecutive samples differing from it */
+static uint8 Test_Level[8];
+static uint8 Test_Count[8];
+
+/* State of the pseudo random generator (xorshift32) */
+static uint32 Test_Random_State = 0x2545F491UL;
+
+/*********************************************************************************************/
+static uint32 Test_Random(void)
+{
+    Test_Random_State ^= Test_Random_State << 13;
+    Test_Random_State ^= Test_Random_State >> 17;
+    Test_Random_State ^= Test_Random_State << 5;
+    return Test_Random_State;
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    uint32 Sample = 0;
+    uint8 Pin = 0;
+    uint8 Levels = 0;
+    uint8 Expected_State = 0;
+    uint8 Expected_Changes = 0;
+
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+    for(Pin = 0 ; Pin < 8U ; Pin++)
+    {
+        Sim_SetInputLevel(TEST_PORT, Pin, STD_LOW);
+        Test_Level[Pin] = STD_LOW;
+    }
+    Debounce_Init();
+    TEST_CHECK(Debounce_GetState(0) == 0U);
+
+    for(Sample = 0 ; (Sample < TEST_SAMPLES) && (Test_Failures == 0U) ; Sample++)
+    {
+        /* Each pin toggles with a probability of 1/4, so both the bounces and the stable levels are frequent */
+        for(Pin = 0 ; Pin < 8U ; Pin++)
+        {
+            if((Test_Random() & 3U) == 0U)
+            {
+                Levels ^= (uint8)(1U << Pin);
+                Sim_SetInputLevel(TEST_PORT, Pin, (uint8)((Levels >> Pin) & 1U));
+            }
+        }
+
+        Debounce_MainFunction();
+
+        Expected_State = 0;
+        Expected_Changes = 0;
+        for(Pin = 0 ; Pin < 8U ; Pin++)
+        {
+            if(((Levels >> Pin) & 1U) != Test_Level[Pin])
+            {
+                Test_Count[Pin]++;
+                if(Test_Count[Pin] == DEBOUNCE_SAMPLES)
+                {
+                    Test_Level[Pin] = (uint8)((Levels >> Pin) & 1U);
+                    Test_Count[Pin] = 0;
+                    Expected_Changes |= (uint8)(1U << Pin);
+                }
+            }
+            else
+            {
+                Test_Count[Pin] = 0;
+            }
+            Expected_State |= (uint8)(Test_Level[Pin] << Pin);
+        }
+        TEST_CHECK(Debounce_GetState(0) == Expected_State);
+        TEST_CHECK(Debounce_GetChanges(0) == Expected_Changes);
+    }
+    TEST_CHECK(Debounce_GetState(1) == 0U);
+
+    return Test_Result("Test_Debounce");
+}
@@ -0,0 +1,125 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Gpt.c
+ *
+ * Description: Host test of the 64-bit SysTick time base: SysTick_GetTimeCycles is read
+ *              in a loop with the interrupts enabled and, every few reads, in a spin with
+ *              the interrupts masked across a SysTick period boundary. The time shall never
+ *              go backwards and shall match the SysTick periods elapsed. Each SysTick
+ *              call back also raises an edge on SW1: its GPIO Port ISR is below the
+ *              SysTick priority, so it shall only run once the SysTick ISR returned and
+ *              read a time not before the one of the SysTick ISR. A tick time out of the
+ *              range of SysTick_Start shall not start the time base.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Gpt.h"
+#include "Port.h"
+#include "Test.h"
+
+/* Number of the reads of the test */
+#define TEST_READS               (40000UL)
+
+/* SysTick period of the test in ms, short so the reads cross many periods */
+#define TEST_TICK_TIME           (1U)
+
+/* Every TEST_MASKED_SPIN_RATE reads, the time is read with the interrupts masked until a period ended */
+#define TEST_MASKED_SPIN_RATE    (4000UL)
+
+/* SW1, configured by Port_Init with an edge interrupt on both edges and a pull up */
+#define TEST_EDGE_PORT           PORT_F
+#define TEST_EDGE_PIN            PIN_4
+
+/* SysTick periods counted by the call back */
+static volatile uint32 Test_Tick_Count = 0;
+
+/* Set while the SysTick call back runs, and the time it read */
+static volatile uint8 Test_In_SysTick = 0;
+static volatile uint64 Test_Tick_Time = 0;
+
+/* Edges taken by the GPIO Port ISR */
+static volatile uint32 Test_Edge_Count = 0;
+
+/*********************************************************************************************/
+static void Test_TickCallBack(void)
+{
+    Test_In_SysTick = 1;
+    Test_Tick_Count++;
+    Test_Tick_Time = SysTick_GetTimeCycles();
+    Sim_SetInputLevel(TEST_EDGE_PORT, TEST_EDGE_PIN, ((Test_Tick_Count & 1U) != 0U) ? STD_LOW : STD_HIGH);
+    Test_In_SysTick = 0;
+}
+
+/*********************************************************************************************/
+static void Test_EdgeCallBack(uint8 Port_Num, uint8 Pins_Mask)
+{
+    (void)Port_Num;
+    (void)Pins_Mask;
+
+    /* Never nested in the SysTick ISR, so the time base already counted its period */
+    TEST_CHECK(Test_In_SysTick == 0U);
+    TEST_CHECK(SysTick_GetTimeCycles() >= Test_Tick_Time);
+    Test_Edge_Count++;
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    uint32 Read = 0;
+    uint32 Ticks = 0;
+    uint64 Time = 0;
+    uint64 Last_Time = 0;
+    uint64 Period = (uint64)GPT_CYCLES_PER_MS * TEST_TICK_TIME;
+
+    Port_Init(&Port_Configuration);
+    Port_SetEdgeCallBack(Test_EdgeCallBack);
+    SysTick_SetCallBack(Test_TickCallBack);
+
+    /* A period of 0 cycles or beyond the 24 bits Reload Register is ignored */
+    SysTick_Start(0U);
+    SysTick_Start(SYSTICK_MAX_TICK_TIME + 1U);
+    TEST_CHECK(SysTick_GetTimeCycles() == 0U);
+
+    SysTick_Start(TEST_TICK_TIME);
+    __asm("CPSIE I");
+
+    for(Read = 0 ; (Read < TEST_READS) && (Test_Failures == 0U) ; Read++)
+    {
+        if((Read % TEST_MASKED_SPIN_RATE) == 0U)
+        {
+            /* The period ending meanwhile is pending, it is seen through PENDSTSET */
+            __asm("CPSID I");
+            Ticks = Sim_GetTickCount();
+            while((Sim_GetTickCount() == Ticks) && (Test_Failures == 0U))
+            {
+                Time = SysTick_GetTimeCycles();
+                TEST_CHECK(Time >= Last_Time);
+                Last_Time = Time;
+            }
+            __asm("CPSIE I");
+        }
+        Time = SysTick_GetTimeCycles();
+        TEST_CHECK(Time >= Last_Time);
+        Last_Time = Time;
+    }
+
+    /* The time is within the period counted by the SysTick ISR */
+    __asm("CPSID I");
+    Time = SysTick_GetTimeCycles();
+    Ticks = Test_Tick_Count;
+    __asm("CPSIE I");
+    TEST_CHECK(Ticks > 10U);
+
+    /* SysTick preempts the GPIO Port ISR, two edges merge when it toggles SW1 before the edge was cleared */
+    TEST_CHECK(Test_Edge_Count > (Ticks / 2U));
+    TEST_CHECK(Test_Edge_Count <= Ticks);
+    TEST_CHECK((Time / Period) >= Ticks);
+    TEST_CHECK((Time / Period) <= (Ticks + 1U));
+    TEST_CHECK(SysTick_GetTimeUs() >= (Time / GPT_CYCLES_PER_US));
+
+    SysTick_Stop();
+    return Test_Result("Test_Gpt");
+}
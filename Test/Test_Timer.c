@@ -0,0 +1,207 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Timer.c
+ *
+ * Description: Host test of the timer wheel against a brute-force reference: all the timers
+ *              are started, stopped and restarted at random between the ticks and from the
+ *              call backs, with delays up to twice the range of the wheel. Every expiry shall
+ *              come exactly at the tick of the reference and no due timer shall be missed.
+ *              The Makefile also runs it with 300 timers on other wheel sizes.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Timer.h"
+#include "Event.h"
+#include "Test.h"
+#include <intrinsics.h>
+
+/* Number of the ticks of the test */
+#define TEST_TICKS               (300000UL)
+
+/* Ticks covered by the wheel */
+#define TEST_WHEEL_RANGE         (1UL << (TIMER_WHEEL_SLOT_BITS * TIMER_WHEEL_LEVELS))
+
+/* Description: Structure to hold the reference of one timer */
+typedef struct
+{
+    boolean Running;
+    uint32 Expiry;          /* tick of the next expiry */
+    uint32 Period;          /* ticks between the expiries, 0 for a one-shot timer */
+    boolean Call_Back;      /* expiry by call back or by event */
+}Test_TimerType;
+
+/* Reference of each timer */
+static Test_TimerType Test_Timers[TIMER_NUMBER_OF_TIMERS];
+
+/* Timer_Tick calls, the tick expired by the current call */
+static uint32 Test_Now = 0;
+
+/* Expiries of the test */
+static uint32 Test_Expiries = 0;
+
+/* State of the pseudo random generator (xorshift32) */
+static uint32 Test_Random_State = 0x9E3779B9UL;
+
+/*********************************************************************************************/
+static uint32 Test_Random(void)
+{
+    Test_Random_State ^= Test_Random_State << 13;
+    Test_Random_State ^= Test_Random_State >> 17;
+    Test_Random_State ^= Test_Random_State << 5;
+    return Test_Random_State;
+}
+
+/*********************************************************************************************/
+/* Description: Random time in ms, mostly short and sometimes up to twice the range of the wheel */
+static uint32 Test_RandomTime(void)
+{
+    uint32 Ticks = 0;
+
+    switch(Test_Random() % 8U)
+    {
+        case 0:
+            Ticks = Test_Random() % (2UL * TEST_WHEEL_RANGE);
+            break;
+        case 1:
+        case 2:
+            Ticks = Test_Random() % 4096U;
+            break;
+        default:
+            Ticks = Test_Random() % 70U;
+            break;
+    }
+    /* Not a multiple of the tick time, so the rounding up is checked too */
+    return (Ticks * TIMER_TICK_TIME) - ((Ticks != 0U) ? (Test_Random() % TIMER_TICK_TIME) : 0U);
+}
+
+static void Test_CallBack(uint16 Timer_Id);
+
+/*********************************************************************************************/
+/* Description: Start or stop a random timer and its reference */
+static void Test_RandomOperation(void)
+{
+    uint16 Timer_Id = (uint16)(Test_Random() % TIMER_NUMBER_OF_TIMERS);
+    uint32 Delay = 0;
+    uint32 Period = 0;
+    boolean Call_Back = FALSE;
+
+    if((Test_Random() % 4U) == 0U)
+    {
+        TEST_CHECK(Timer_Stop(Timer_Id) == (Test_Timers[Timer_Id].Running ? E_OK : E_NOT_OK));
+        Test_Timers[Timer_Id].Running = FALSE;
+    }
+    else
+    {
+        Delay = Test_RandomTime();
+        Period = ((Test_Random() % 2U) == 0U) ? 0U : Test_RandomTime();
+        Call_Back = ((Test_Random() % 8U) != 0U) ? TRUE : FALSE;
+        TEST_CHECK(Timer_Start(Timer_Id, Delay, Period, (Call_Back == TRUE) ? Test_CallBack : NULL_PTR) == E_OK);
+        Test_Timers[Timer_Id].Running   = TRUE;
+        Test_Timers[Timer_Id].Expiry    = Test_Now + ((Delay == 0U) ? 1U : ((Delay + TIMER_TICK_TIME - 1U) / TIMER_TICK_TIME));
+        Test_Timers[Timer_Id].Period    = (Period + TIMER_TICK_TIME - 1U) / TIMER_TICK_TIME;
+        Test_Timers[Timer_Id].Call_Back = Call_Back;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Check one expiry against the reference and update the reference */
+static void Test_Expire(uint16 Timer_Id, boolean Call_Back)
+{
+    Test_TimerType * Timer_Ptr = &Test_Timers[Timer_Id];
+
+    TEST_CHECK(Timer_Ptr->Running == TRUE);
+    TEST_CHECK(Timer_Ptr->Expiry == Test_Now);
+    TEST_CHECK(Timer_Ptr->Call_Back == Call_Back);
+    if(Timer_Ptr->Period != 0U)
+    {
+        Timer_Ptr->Expiry += Timer_Ptr->Period;
+    }
+    else
+    {
+        Timer_Ptr->Running = FALSE;
+    }
+    TEST_CHECK(Timer_IsRunning(Timer_Id) == Timer_Ptr->Running);
+    Test_Expiries++;
+}
+
+/*********************************************************************************************/
+/* Description: Check the expiries without call back, posted as events */
+static void Test_ReceiveEvents(void)
+{
+    Event_Type Event;
+
+    while(Event_Receive(&Event) == E_OK)
+    {
+        TEST_CHECK(Event.Type == EVENT_TIMER_EXPIRY);
+        Test_Expire((uint16)(Event.Source | ((uint16)Event.Data << 8)), FALSE);
+    }
+}
+
+/*********************************************************************************************/
+static void Test_CallBack(uint16 Timer_Id)
+{
+    /* The expiries of this tick posted before this call back are checked before the reference changes */
+    Test_ReceiveEvents();
+    Test_Expire(Timer_Id, TRUE);
+
+    /* Restart or stop timers from the call back, the expiring one included */
+    if((Test_Random() % 4U) == 0U)
+    {
+        Test_RandomOperation();
+    }
+}
+
+/*********************************************************************************************/
+int main(void)
+{
+    uint32 Tick = 0;
+    uint32 Count = 0;
+    uint16 Timer_Id = 0;
+
+    Timer_Init();
+    TEST_CHECK(Timer_Start(TIMER_NUMBER_OF_TIMERS, 0, 0, NULL_PTR) == E_NOT_OK);
+    TEST_CHECK(Timer_Stop(0) == E_NOT_OK);
+    TEST_CHECK(Timer_IsRunning(TIMER_NUMBER_OF_TIMERS) == FALSE);
+
+    /* The PRIMASK of the caller is restored, the test runs with the interrupts disabled as at reset */
+    TEST_CHECK(Timer_Start(0, 0, 0, NULL_PTR) == E_OK);
+    TEST_CHECK(__get_PRIMASK() == 1U);
+    __asm("CPSIE I");
+    TEST_CHECK(Timer_Stop(0) == E_OK);
+    TEST_CHECK(__get_PRIMASK() == 0U);
+    __asm("CPSID I");
+#if (TIMER_TICK_TIME > 2U)
+    TEST_CHECK(Timer_Start(0, 0xFFFFFFFFUL, 0xFFFFFFFFUL, NULL_PTR) == E_OK);
+    TEST_CHECK(Timer_Stop(0) == E_OK);
+#else
+    TEST_CHECK(Timer_Start(0, 0xFFFFFFFFUL, 0, NULL_PTR) == E_NOT_OK);
+    TEST_CHECK(Timer_Start(0, 0, 0xFFFFFFFFUL, NULL_PTR) == E_NOT_OK);
+#endif
+
+    for(Tick = 0 ; (Tick < TEST_TICKS) && (Test_Failures == 0U) ; Tick++)
+    {
+        for(Count = Test_Random() % 4U ; Count != 0U ; Count--)
+        {
+            Test_RandomOperation();
+        }
+
+        Test_Now++;
+        Timer_Tick();
+
+        Test_ReceiveEvents();
+
+        /* No timer of the reference is due any more */
+        for(Timer_Id = 0 ; Timer_Id < TIMER_NUMBER_OF_TIMERS ; Timer_Id++)
+        {
+            TEST_CHECK((Test_Timers[Timer_Id].Running == FALSE) || ((sint32)(Test_Timers[Timer_Id].Expiry - Test_Now) > 0));
+        }
+    }
+    TEST_CHECK(Event_GetLostCount() == 0U);
+    printf("Test_Timer: %u timers, %u levels of %u slots, %u expiries\n", (unsigned int)TIMER_NUMBER_OF_TIMERS,
+           (unsigned int)TIMER_WHEEL_LEVELS, (unsigned int)(1U << TIMER_WHEEL_SLOT_BITS), (unsigned int)Test_Expiries);
+
+    return Test_Result("Test_Timer");
+}
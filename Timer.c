@@ -0,0 +1,289 @@
+ /******************************************************************************
+ *
+ * Module: Timer
+ *
+ * File Name: Timer.c
+ *
+ * Description: Source file for Timer Service.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Timer.h"
+#include "Event.h"
+#include "Os_Cfg.h"
+#include <intrinsics.h>
+
+/* Timer_Tick is called at each Os tick */
+#if (TIMER_TICK_TIME != OS_BASE_TIME)
+  #error "TIMER_TICK_TIME does not match OS_BASE_TIME"
+#endif
+
+/* Save the PRIMASK then disable IRQ Interrupts ... so the services can be called with the interrupts disabled. */
+#define Disable_Interrupts(PRIMASK)    do { (PRIMASK) = __get_PRIMASK(); __asm("CPSID I"); } while(0)
+
+/* Restore IRQ Interrupts ... This Macro restores the PRIMASK saved by Disable_Interrupts. */
+#define Restore_Interrupts(PRIMASK)    __set_PRIMASK(PRIMASK)
+
+/* Longest time of a timer in ticks (2 ^ 31), half the range of the tick counter */
+#define TIMER_MAX_TICKS        (0x80000000UL)
+
+/* Slots of one level of the wheel and mask of the slot index */
+#define TIMER_WHEEL_SLOTS      ((uint16)(1U << TIMER_WHEEL_SLOT_BITS))
+#define TIMER_SLOT_MASK        ((uint32)TIMER_WHEEL_SLOTS - 1U)
+
+/* Ticks covered by the levels below the given level, and by the whole wheel */
+#define TIMER_LEVEL_RANGE(LEVEL)   ((uint32)1U << (TIMER_WHEEL_SLOT_BITS * (LEVEL)))
+#define TIMER_WHEEL_RANGE          TIMER_LEVEL_RANGE(TIMER_WHEEL_LEVELS)
+
+/* End of a slot list or no slot list for a stopped timer */
+#define TIMER_NONE             (0xFFFFU)
+
+/* Description: Structure to hold one software timer, linked in the list of its wheel slot while it is running */
+typedef struct
+{
+    uint32 Expiry;          /* tick of the next expiry */
+    uint32 Period;          /* ticks between the expiries, 0 for a one-shot timer */
+    void (*Call_Back)(uint16 Timer_Id);
+    uint16 Next;
+    uint16 Prev;
+    uint16 List;            /* slot list holding the timer, TIMER_NONE while it is stopped */
+}Timer_Type;
+
+/* Software timers */
+static Timer_Type g_Timers[TIMER_NUMBER_OF_TIMERS];
+
+/* First timer of each slot list of the wheel, level by level */
+static uint16 g_Timer_Slots[TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS];
+
+/* Number of Timer_Tick calls, the tick of the last expired slot */
+static uint32 g_Timer_Now = 0;
+
+/*********************************************************************************************/
+/* Description: Convert a time in ms to ticks rounded up, without overflow */
+LOCAL_INLINE uint32 Timer_MsToTicks(uint32 Time)
+{
+    return (Time / TIMER_TICK_TIME) + (((Time % TIMER_TICK_TIME) != 0U) ? 1U : 0U);
+}
+
+/*********************************************************************************************/
+/*
+ * Description: Link a timer in the slot of its expiry in the lowest level covering its remaining ticks.
+ * A level only gets its slots expired or moved down when the slot before them in the next level starts,
+ * so each timer is moved down at most TIMER_WHEEL_LEVELS - 1 times. A timer beyond the wheel is held in
+ * the last slot of the last level covered from now and placed again when this slot is moved down.
+ */
+static void Timer_Insert(uint16 Timer_Id)
+{
+    Timer_Type * Timer_Ptr = &g_Timers[Timer_Id];
+    uint32 Expiry = Timer_Ptr->Expiry;
+    uint32 Ticks = Expiry - g_Timer_Now;
+    uint8 Level = 0;
+
+    if(Ticks >= TIMER_WHEEL_RANGE)
+    {
+        Expiry = g_Timer_Now + TIMER_WHEEL_RANGE - 1U;
+        Ticks = TIMER_WHEEL_RANGE - 1U;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    while(Ticks >= TIMER_LEVEL_RANGE(Level + 1U))
+    {
+        Level++;
+    }
+
+    Timer_Ptr->List = (uint16)((Level * TIMER_WHEEL_SLOTS) + ((Expiry >> (TIMER_WHEEL_SLOT_BITS * Level)) & TIMER_SLOT_MASK));
+    Timer_Ptr->Prev = TIMER_NONE;
+    Timer_Ptr->Next = g_Timer_Slots[Timer_Ptr->List];
+    if(Timer_Ptr->Next != TIMER_NONE)
+    {
+        g_Timers[Timer_Ptr->Next].Prev = Timer_Id;
+    }
+    g_Timer_Slots[Timer_Ptr->List] = Timer_Id;
+}
+
+/*********************************************************************************************/
+/* Description: Unlink a running timer from its slot list */
+static void Timer_Remove(uint16 Timer_Id)
+{
+    Timer_Type * Timer_Ptr = &g_Timers[Timer_Id];
+
+    if(Timer_Ptr->Prev != TIMER_NONE)
+    {
+        g_Timers[Timer_Ptr->Prev].Next = Timer_Ptr->Next;
+    }
+    else
+    {
+        g_Timer_Slots[Timer_Ptr->List] = Timer_Ptr->Next;
+    }
+    if(Timer_Ptr->Next != TIMER_NONE)
+    {
+        g_Timers[Timer_Ptr->Next].Prev = Timer_Ptr->Prev;
+    }
+    Timer_Ptr->List = TIMER_NONE;
+}
+
+/*********************************************************************************************/
+/* Description: Move the timers of the slot of a level starting at this tick down to the lower levels */
+static void Timer_Cascade(uint8 Level)
+{
+    uint16 List = (uint16)((Level * TIMER_WHEEL_SLOTS) + ((g_Timer_Now >> (TIMER_WHEEL_SLOT_BITS * Level)) & TIMER_SLOT_MASK));
+    uint16 Timer_Id = g_Timer_Slots[List];
+    uint16 Next = 0;
+
+    /* The list is detached first as a timer beyond the wheel goes back to the same slot */
+    g_Timer_Slots[List] = TIMER_NONE;
+    while(Timer_Id != TIMER_NONE)
+    {
+        Next = g_Timers[Timer_Id].Next;
+        Timer_Insert(Timer_Id);
+        Timer_Id = Next;
+    }
+}
+
+/*********************************************************************************************/
+void Timer_Init(void)
+{
+    uint16 Count = 0;
+
+    for(Count = 0 ; Count < (TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS) ; Count++)
+    {
+        g_Timer_Slots[Count] = TIMER_NONE;
+    }
+    for(Count = 0 ; Count < TIMER_NUMBER_OF_TIMERS ; Count++)
+    {
+        g_Timers[Count].List = TIMER_NONE;
+    }
+}
+
+/*********************************************************************************************/
+Std_ReturnType Timer_Start(uint16 Timer_Id, uint32 Delay, uint32 Period, void (*Call_Back)(uint16 Timer_Id))
+{
+    Std_ReturnType Result = E_NOT_OK;
+    uint32 Ticks = Timer_MsToTicks(Delay);
+    uint32 Period_Ticks = Timer_MsToTicks(Period);
+    uint32 Primask = 0;
+
+    if((Timer_Id < TIMER_NUMBER_OF_TIMERS) && (Ticks <= TIMER_MAX_TICKS) && (Period_Ticks <= TIMER_MAX_TICKS))
+    {
+        if(Ticks == 0U)
+        {
+            Ticks = 1U;
+        }
+        Disable_Interrupts(Primask);
+        if(g_Timers[Timer_Id].List != TIMER_NONE)
+        {
+            Timer_Remove(Timer_Id);
+        }
+        g_Timers[Timer_Id].Expiry    = g_Timer_Now + Ticks;
+        g_Timers[Timer_Id].Period    = Period_Ticks;
+        g_Timers[Timer_Id].Call_Back = Call_Back;
+        Timer_Insert(Timer_Id);
+        Restore_Interrupts(Primask);
+        Result = E_OK;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return Result;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Timer_Stop(uint16 Timer_Id)
+{
+    Std_ReturnType Result = E_NOT_OK;
+    uint32 Primask = 0;
+
+    if(Timer_Id < TIMER_NUMBER_OF_TIMERS)
+    {
+        Disable_Interrupts(Primask);
+        if(g_Timers[Timer_Id].List != TIMER_NONE)
+        {
+            Timer_Remove(Timer_Id);
+            Result = E_OK;
+        }
+        Restore_Interrupts(Primask);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return Result;
+}
+
+/*********************************************************************************************/
+boolean Timer_IsRunning(uint16 Timer_Id)
+{
+    boolean Running = FALSE;
+
+    if(Timer_Id < TIMER_NUMBER_OF_TIMERS)
+    {
+        Running = (g_Timers[Timer_Id].List != TIMER_NONE) ? TRUE : FALSE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return Running;
+}
+
+/*********************************************************************************************/
+/*
+ * Description: The slots of the higher levels starting at this tick are moved down, the highest first,
+ * then all the timers of the level 0 slot of this tick expire. The lists are only changed with the
+ * interrupts disabled, the PRIMASK of the caller is restored around each call back so it can start or
+ * stop timers.
+ */
+void Timer_Tick(void)
+{
+    uint8 Level = 1;
+    uint16 List = 0;
+    uint16 Timer_Id = 0;
+    void (*Call_Back)(uint16 Timer_Id) = NULL_PTR;
+    uint32 Primask = 0;
+
+    Disable_Interrupts(Primask);
+    g_Timer_Now++;
+
+    while((Level < TIMER_WHEEL_LEVELS) && ((g_Timer_Now & (TIMER_LEVEL_RANGE(Level) - 1U)) == 0U))
+    {
+        Level++;
+    }
+    while(Level > 1U)
+    {
+        Level--;
+        Timer_Cascade(Level);
+    }
+
+    List = (uint16)(g_Timer_Now & TIMER_SLOT_MASK);
+    Timer_Id = g_Timer_Slots[List];
+    while(Timer_Id != TIMER_NONE)
+    {
+        Timer_Remove(Timer_Id);
+        Call_Back = g_Timers[Timer_Id].Call_Back;
+        if(g_Timers[Timer_Id].Period != 0U)
+        {
+            /* The next expiry of a periodic timer does not drift with the call back */
+            g_Timers[Timer_Id].Expiry += g_Timers[Timer_Id].Period;
+            Timer_Insert(Timer_Id);
+        }
+        Restore_Interrupts(Primask);
+
+        if(Call_Back != NULL_PTR)
+        {
+            (*Call_Back)(Timer_Id);
+        }
+        else
+        {
+            /* The SysTick ISR is the only producer of its event queue */
+            (void)Event_Post(EventConf_SYSTICK_ISR_QUEUE, EVENT_TIMER_EXPIRY, (uint8)Timer_Id, (uint8)(Timer_Id >> 8));
+        }
+
+        Disable_Interrupts(Primask);
+        Timer_Id = g_Timer_Slots[List];
+    }
+    Restore_Interrupts(Primask);
+}
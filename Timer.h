@@ -0,0 +1,49 @@
+ /******************************************************************************
+ *
+ * Module: Timer
+ *
+ * File Name: Timer.h
+ *
+ * Description: Header file for Timer Service.
+ *
+ *              One-shot and periodic software timers on the Os tick, held in a hierarchical
+ *              timer wheel: starting, stopping and expiring a timer take a constant time
+ *              whatever the number of running timers. Timer_Tick is called by the SysTick ISR
+ *              through the Os, so the call backs run in the SysTick ISR and shall be short.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef TIMER_H_
+#define TIMER_H_
+
+#include "Std_Types.h"
+
+/* Timer Service Pre-Compile Configuration Header file */
+#include "Timer_Cfg.h"
+
+/* Description: Function to initialize the Timer Service with all the timers stopped, called before the first Timer_Tick */
+void Timer_Init(void);
+
+/*
+ * Description: Function to start or restart a timer:
+ *	1. Delay: time in ms to the first expiry, rounded up to a multiple of TIMER_TICK_TIME and at least one tick
+ *	2. Period: time in ms between the next expiries of a periodic timer, 0 for a one-shot timer
+ *	3. Call_Back: function called at each expiry with the timer id, NULL_PTR to post an EVENT_TIMER_EXPIRY
+ *	   with the timer id as its source to the SysTick ISR event queue instead
+ * Returns E_NOT_OK for an invalid timer id or a time above 2 ^ 31 ticks.
+ * It disables the interrupts for a short time and restores the PRIMASK of the caller.
+ */
+Std_ReturnType Timer_Start(uint16 Timer_Id, uint32 Delay, uint32 Period, void (*Call_Back)(uint16 Timer_Id));
+
+/* Description: Function to stop a timer, returns E_NOT_OK for an invalid timer id or a stopped timer,
+ * it restores the PRIMASK of the caller as Timer_Start */
+Std_ReturnType Timer_Stop(uint16 Timer_Id);
+
+/* Description: Function to check if a timer is running, returns FALSE for an invalid timer id */
+boolean Timer_IsRunning(uint16 Timer_Id);
+
+/* Description: Function called at each Os tick by the SysTick ISR to expire the due timers */
+void Timer_Tick(void);
+
+#endif /* TIMER_H_ */
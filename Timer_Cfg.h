@@ -0,0 +1,29 @@
+ /******************************************************************************
+ *
+ * Module: Timer
+ *
+ * File Name: Timer_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for Timer Service.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef TIMER_CFG_H_
+#define TIMER_CFG_H_
+
+/* Number of the software timers, the timer ids are 0 to TIMER_NUMBER_OF_TIMERS - 1 (at most 65535) */
+#define TIMER_NUMBER_OF_TIMERS      (16U)
+
+/* Period in ms of the Timer_Tick calls, the Os tick ... shall be OS_BASE_TIME, checked by Timer.c */
+#define TIMER_TICK_TIME             (20U)
+
+/*
+ * Wheel levels and slots per level (2 ^ TIMER_WHEEL_SLOT_BITS), a timer is kept in the level of its
+ * remaining ticks so the timers expire in O(1). With 3 levels of 64 slots the wheel covers 262144 ticks,
+ * longer timers are held in the last level and placed again when they reach it.
+ */
+#define TIMER_WHEEL_LEVELS          (3U)
+#define TIMER_WHEEL_SLOT_BITS       (6U)
+
+#endif /* TIMER_CFG_H_ */
@@ -0,0 +1,579 @@
+#!/usr/bin/env python3
+###############################################################################
+#
+# Module: Port
+#
+# File Name: Port_Gen.py
+#
+# Description: Host side configuration generator for TM4C123GH6PM Microcontroller - Port Driver.
+#              Reads a JSON pin description, checks the pin mux legality of every pin and
+#              generates Port_Cfg.h and Port_PBcfg.c with the register image of each port
+#              already computed, so Port_Init only copies the images into the registers.
+#              The pin mux table of Port_Lcfg.c is generated from the datasheet mux matrix below.
+#
+# Usage: python3 Tools/Port_Gen.py Tools/Port_Config.json [-o OUTPUT_DIRECTORY]
+#
+# Author: Ahmed Essam
+###############################################################################
+
+import argparse
+import json
+import os
+import sys
+
+# Port Pin ID numbers in the order of the Port_ConfigType Pins array (same as Port_Cfg.h)
+PORT_PINS = ([("A", n) for n in range(8)] + [("B", n) for n in range(8)] +
+             [("C", n) for n in range(8)] + [("D", n) for n in range(8)] +
+             [("E", n) for n in range(6)] + [("F", n) for n in range(5)])
+PORTS = "ABCDEF"
+
+MODES = ["DIO", "ADC", "UART", "SSI", "I2C", "CAN", "USB", "GPT", "PWM", "QEI", "ANALOG_COMP", "NMI", "TRACE"]
+DIRECTIONS = {"IN": "PORT_PIN_IN", "OUT": "PORT_PIN_OUT"}
+RESISTORS = {"OFF": "OFF", "PULL_UP": "PULL_UP", "PULL_DOWN": "PULL_DOWN"}
+LEVELS = {"LOW": "STD_LOW", "HIGH": "STD_HIGH"}
+CURRENTS = ["R2R", "R4R", "R8R"]
+EDGES = {"NONE": "PORT_PIN_EDGE_NONE", "RISING": "PORT_PIN_EDGE_RISING",
+         "FALLING": "PORT_PIN_EDGE_FALLING", "BOTH": "PORT_PIN_EDGE_BOTH"}
+
+# Pin mux values used in addition to the PMCx values (same as Port.h)
+PMC_GPIO = 0x00
+PMC_ANALOG = 0x10
+PMC_ILLEGAL = 0xFF
+
+# TM4C123GH6PM GPIO pins and alternate functions (datasheet table 23-5):
+# the digital functions of each pin by PMCx value, and its analog functions
+MUX_MATRIX = {
+    ("A", 0): ({1: "U0Rx", 8: "CAN1Rx"}, []),
+    ("A", 1): ({1: "U0Tx", 8: "CAN1Tx"}, []),
+    ("A", 2): ({2: "SSI0Clk"}, []),
+    ("A", 3): ({2: "SSI0Fss"}, []),
+    ("A", 4): ({2: "SSI0Rx"}, []),
+    ("A", 5): ({2: "SSI0Tx"}, []),
+    ("A", 6): ({3: "I2C1SCL", 5: "M1PWM2"}, []),
+    ("A", 7): ({3: "I2C1SDA", 5: "M1PWM3"}, []),
+    ("B", 0): ({1: "U1Rx", 7: "T2CCP0"}, ["USB0ID"]),
+    ("B", 1): ({1: "U1Tx", 7: "T2CCP1"}, ["USB0VBUS"]),
+    ("B", 2): ({3: "I2C0SCL", 7: "T3CCP0"}, []),
+    ("B", 3): ({3: "I2C0SDA", 7: "T3CCP1"}, []),
+    ("B", 4): ({2: "SSI2Clk", 4: "M0PWM2", 7: "T1CCP0", 8: "CAN0Rx"}, ["AIN10"]),
+    ("B", 5): ({2: "SSI2Fss", 4: "M0PWM3", 7: "T1CCP1", 8: "CAN0Tx"}, ["AIN11"]),
+    ("B", 6): ({2: "SSI2Rx", 4: "M0PWM0", 7: "T0CCP0"}, []),
+    ("B", 7): ({2: "SSI2Tx", 4: "M0PWM1", 7: "T0CCP1"}, []),
+    ("C", 0): ({1: "TCK", 7: "T4CCP0"}, []),
+    ("C", 1): ({1: "TMS", 7: "T4CCP1"}, []),
+    ("C", 2): ({1: "TDI", 7: "T5CCP0"}, []),
+    ("C", 3): ({1: "TDO", 7: "T5CCP1"}, []),
+    ("C", 4): ({1: "U4Rx", 2: "U1Rx", 4: "M0PWM6", 6: "IDX1", 7: "WT0CCP0", 8: "U1RTS"}, ["C1-"]),
+    ("C", 5): ({1: "U4Tx", 2: "U1Tx", 4: "M0PWM7", 6: "PhA1", 7: "WT0CCP1", 8: "U1CTS"}, ["C1+"]),
+    ("C", 6): ({1: "U3Rx", 6: "PhB1", 7: "WT1CCP0", 8: "USB0EPEN"}, ["C0+"]),
+    ("C", 7): ({1: "U3Tx", 7: "WT1CCP1", 8: "USB0PFLT"}, ["C0-"]),
+    ("D", 0): ({1: "SSI3Clk", 2: "SSI1Clk", 3: "I2C3SCL", 4: "M0PWM6", 5: "M1PWM0", 7: "WT2CCP0"}, ["AIN7"]),
+    ("D", 1): ({1: "SSI3Fss", 2: "SSI1Fss", 3: "I2C3SDA", 4: "M0PWM7", 5: "M1PWM1", 7: "WT2CCP1"}, ["AIN6"]),
+    ("D", 2): ({1: "SSI3Rx", 2: "SSI1Rx", 4: "M0FAULT0", 7: "WT3CCP0", 8: "USB0EPEN"}, ["AIN5"]),
+    ("D", 3): ({1: "SSI3Tx", 2: "SSI1Tx", 6: "IDX0", 7: "WT3CCP1", 8: "USB0PFLT"}, ["AIN4"]),
+    ("D", 4): ({1: "U6Rx", 7: "WT4CCP0"}, ["USB0DM"]),
+    ("D", 5): ({1: "U6Tx", 7: "WT4CCP1"}, ["USB0DP"]),
+    ("D", 6): ({1: "U2Rx", 4: "M0FAULT0", 6: "PhA0", 7: "WT5CCP0"}, []),
+    ("D", 7): ({1: "U2Tx", 6: "PhB0", 7: "WT5CCP1", 8: "NMI"}, []),
+    ("E", 0): ({1: "U7Rx"}, ["AIN3"]),
+    ("E", 1): ({1: "U7Tx"}, ["AIN2"]),
+    ("E", 2): ({}, ["AIN1"]),
+    ("E", 3): ({}, ["AIN0"]),
+    ("E", 4): ({1: "U5Rx", 3: "I2C2SCL", 4: "M0PWM4", 5: "M1PWM2", 8: "CAN0Rx"}, ["AIN9"]),
+    ("E", 5): ({1: "U5Tx", 3: "I2C2SDA", 4: "M0PWM5", 5: "M1PWM3", 8: "CAN0Tx"}, ["AIN8"]),
+    ("F", 0): ({1: "U1RTS", 2: "SSI1Rx", 3: "CAN0Rx", 5: "M1PWM4", 6: "PhA0", 7: "T0CCP0", 8: "NMI", 9: "C0o"}, []),
+    ("F", 1): ({1: "U1CTS", 2: "SSI1Tx", 5: "M1PWM5", 6: "IDX1", 7: "T0CCP1", 9: "C1o", 14: "TRD1"}, []),
+    ("F", 2): ({2: "SSI1Clk", 4: "M0FAULT0", 5: "M1PWM6", 7: "T1CCP0", 14: "TRD0"}, []),
+    ("F", 3): ({2: "SSI1Fss", 3: "CAN0Tx", 5: "M1PWM7", 7: "T1CCP1", 14: "TRCLK"}, []),
+    ("F", 4): ({5: "M1FAULT0", 6: "IDX0", 7: "T2CCP0", 8: "USB0EPEN"}, []),
+}
+
+# Port Pin mode of each signal of the mux matrix, by signal name prefix (JTAG signals have no mode)
+SIGNAL_MODES = [("AIN", "ADC"), ("U", "UART"), ("SSI", "SSI"), ("I2C", "I2C"), ("CAN", "CAN"),
+                ("USB", "USB"), ("T", "GPT"), ("WT", "GPT"), ("M0", "PWM"), ("M1", "PWM"),
+                ("IDX", "QEI"), ("Ph", "QEI"), ("C0", "ANALOG_COMP"), ("C1", "ANALOG_COMP"),
+                ("NMI", "NMI"), ("TR", "TRACE")]
+
+
+class ConfigError(Exception):
+    pass
+
+
+def pin_id(port, num):
+    return PORT_PINS.index((port, num))
+
+
+def pin_name(pin):
+    return "P%s%d" % PORT_PINS[pin]
+
+
+def signal_mode(signal):
+    if signal in ("TCK", "TMS", "TDI", "TDO"):
+        return None
+    return max((prefix for prefix in SIGNAL_MODES if signal.startswith(prefix[0])), key=lambda p: len(p[0]))[1]
+
+
+def pin_mode_entry(pin, mode):
+    """Pin mux table entry of a mode on a pin: default value and alternative PMCx values, see Port_PinModePmcType"""
+    if mode == "DIO":
+        return PMC_GPIO, []
+    digital, analog = MUX_MATRIX[PORT_PINS[pin]]
+    pmcs = sorted(pmc for pmc, signal in digital.items() if signal_mode(signal) == mode)
+    if any(signal_mode(signal) == mode for signal in analog):
+        if pmcs:
+            raise ValueError("%s: analog and digital %s functions" % (pin_name(pin), mode))
+        return PMC_ANALOG, []
+    if not pmcs:
+        return PMC_ILLEGAL, []
+    if len(pmcs) > 3:
+        raise ValueError("%s: more than 3 %s functions" % (pin_name(pin), mode))
+    return pmcs[0], pmcs[1:]
+
+
+def pin_mode_table():
+    """Pin mux table of each Port Pin and mode, packed as Port_PinModePmcType"""
+    table = []
+    for pin in range(len(PORT_PINS)):
+        row = []
+        for mode in MODES:
+            default, alternatives = pin_mode_entry(pin, mode)
+            entry = default
+            for index, pmc in enumerate(alternatives):
+                entry |= pmc << (8 + 4 * index)
+            row.append(entry)
+        table.append(row)
+    return table
+
+
+def pin_mode_pmc(pin, mode, pmc_select=0):
+    """Pin mux of a mode on a pin, same lookup as Port_GetPinModePmc in Port.c"""
+    default, alternatives = pin_mode_entry(pin, mode)
+    if pmc_select == 0 or pmc_select == default:
+        return default
+    return pmc_select if pmc_select in alternatives else PMC_ILLEGAL
+
+
+def load_pins(config):
+    """Validate the JSON pins description and return the pins ordered by Port Pin ID"""
+    options = config.get("options", {})
+    optional = options.get("PORT_OPTIONAL_CONFIG", False)
+    pins = [None] * len(PORT_PINS)
+    for entry in config.get("pins", []):
+        try:
+            port, num = entry["port"], entry["pin"]
+        except KeyError:
+            raise ConfigError("pin entry without port/pin: %s" % entry)
+        if (port, num) not in PORT_PINS:
+            raise ConfigError("P%s%s does not exist" % (port, num))
+        pin = pin_id(port, num)
+        if pins[pin] is not None:
+            raise ConfigError("%s is configured twice" % pin_name(pin))
+        pin_cfg = {
+            "mode": entry.get("mode", "DIO"),
+            "pmc": entry.get("pmc", 0),
+            "direction": entry.get("direction", "IN"),
+            "resistor": entry.get("resistor", "OFF"),
+            "level": entry.get("level", "LOW"),
+            "direction_changeable": bool(entry.get("direction_changeable", False)),
+            "mode_changeable": bool(entry.get("mode_changeable", False)),
+            "open_drain": bool(entry.get("open_drain", False)),
+            "current": entry.get("current", "R2R"),
+            "slew_rate": bool(entry.get("slew_rate", False)),
+            "edge": entry.get("edge", "NONE"),
+            "comment": entry.get("comment", ""),
+        }
+        for key, allowed in (("mode", MODES), ("direction", DIRECTIONS), ("resistor", RESISTORS),
+                             ("level", LEVELS), ("current", CURRENTS), ("edge", EDGES)):
+            if pin_cfg[key] not in allowed:
+                raise ConfigError("%s: invalid %s '%s'" % (pin_name(pin), key, pin_cfg[key]))
+        if pin_cfg["pmc"] not in range(15):
+            raise ConfigError("%s: invalid pmc '%s'" % (pin_name(pin), pin_cfg["pmc"]))
+        if not optional and any(k in entry for k in ("open_drain", "current", "slew_rate")):
+            raise ConfigError("%s: optional configuration used while PORT_OPTIONAL_CONFIG is off" % pin_name(pin))
+        if not options.get("PORT_EDGE_INTERRUPTS", False) and "edge" in entry:
+            raise ConfigError("%s: edge interrupt used while PORT_EDGE_INTERRUPTS is off" % pin_name(pin))
+        pins[pin] = pin_cfg
+    missing = [pin_name(pin) for pin, cfg in enumerate(pins) if cfg is None]
+    if missing:
+        raise ConfigError("pins not configured: %s" % ", ".join(missing))
+
+    # Pin mux legality, these mistakes were silently ignored by Port_Init at run time
+    for pin, cfg in enumerate(pins):
+        port, num = PORT_PINS[pin]
+        if port == "C" and num <= 3 and cfg["mode"] != "DIO":
+            raise ConfigError("%s is a JTAG pin, mode %s is not allowed" % (pin_name(pin), cfg["mode"]))
+        if pin_mode_pmc(pin, cfg["mode"], cfg["pmc"]) == PMC_ILLEGAL:
+            if cfg["pmc"]:
+                raise ConfigError("%s: mode %s with PMC %s is not available on this pin" % (pin_name(pin), cfg["mode"], cfg["pmc"]))
+            raise ConfigError("%s: mode %s is not available on this pin" % (pin_name(pin), cfg["mode"]))
+        if cfg["mode"] == "ADC" and cfg["direction"] != "IN":
+            raise ConfigError("%s: ADC mode needs an input pin" % pin_name(pin))
+        if cfg["edge"] != "NONE" and (cfg["direction"] != "IN" or cfg["mode"] != "DIO" or (port == "C" and num <= 3)):
+            raise ConfigError("%s: edge interrupt needs a DIO input pin" % pin_name(pin))
+    return pins
+
+
+def reg_images(pins, optional):
+    """Reduce the pins configuration into one register image per port, same as Port_Init"""
+    fields = ["Pins_Mask", "Mode_Mask", "Commit", "Dir", "Data", "Den", "Afsel", "Amsel",
+              "Pur", "Pdr", "Odr", "Dr2r", "Dr4r", "Dr8r", "Slr", "Ibe", "Iev", "Im", "Pctl"]
+    images = [dict.fromkeys(fields, 0) for _ in PORTS]
+    for pin, cfg in enumerate(pins):
+        port, num = PORT_PINS[pin]
+        image = images[PORTS.index(port)]
+        mask = 1 << num
+        image["Pins_Mask"] |= mask
+        if (port, num) in (("D", 7), ("F", 0)):
+            image["Commit"] |= mask
+        if cfg["direction"] == "OUT":
+            image["Dir"] |= mask
+            if cfg["level"] == "HIGH":
+                image["Data"] |= mask
+            if optional:
+                if cfg["open_drain"]:
+                    image["Odr"] |= mask
+                image["D" + cfg["current"].lower()] |= mask
+                if cfg["current"] == "R8R" and cfg["slew_rate"]:
+                    image["Slr"] |= mask
+        else:
+            if cfg["resistor"] == "PULL_UP":
+                image["Pur"] |= mask
+            elif cfg["resistor"] == "PULL_DOWN":
+                image["Pdr"] |= mask
+            if cfg["edge"] != "NONE":
+                image["Im"] |= mask
+                if cfg["edge"] == "BOTH":
+                    image["Ibe"] |= mask
+                elif cfg["edge"] == "RISING":
+                    image["Iev"] |= mask
+        if port == "C" and num <= 3:
+            continue  # JTAG pins
+        image["Mode_Mask"] |= mask
+        pmc = pin_mode_pmc(pin, cfg["mode"], cfg["pmc"])
+        if pmc == PMC_ANALOG:
+            image["Afsel"] |= mask
+            image["Amsel"] |= mask
+        else:
+            image["Den"] |= mask
+            if pmc != PMC_GPIO:
+                image["Afsel"] |= mask
+                image["Pctl"] |= pmc << (num * 4)
+    return fields, images
+
+
+def std_on_off(value):
+    return "STD_ON" if value else "STD_OFF"
+
+
+PORT_CFG_H = """ /******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Port Driver
+ *              Generated by Tools/Port_Gen.py from {source}
+ *
+ * Author: Ahmed Essam
+ ******************************************************************************/
+
+#ifndef PORT_CFG_H
+#define PORT_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define PORT_CFG_SW_MAJOR_VERSION              (1U)
+#define PORT_CFG_SW_MINOR_VERSION              (0U)
+#define PORT_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define PORT_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define PORT_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define PORT_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define PORT_DEV_ERROR_DETECT                ({PORT_DEV_ERROR_DETECT})
+
+/* Pre-compile option for Set Pin Direction API */
+#define PORT_SET_PIN_DIRECTION_API           ({PORT_SET_PIN_DIRECTION_API})
+
+/* Pre-compile option for Set Pin Mode API */
+#define PORT_SET_PIN_MODE_API                ({PORT_SET_PIN_MODE_API})
+
+/* Pre-compile option for Version Info API */
+#define PORT_VERSION_INFO_API                ({PORT_VERSION_INFO_API})
+
+/* Pre-compile option for optional MCU Ports and Port Pins Configurations */
+#define PORT_OPTIONAL_CONFIG                 ({PORT_OPTIONAL_CONFIG})
+
+/* Pre-compile option for using the port register images precomputed by Tools/Port_Gen.py in Port_PBcfg.c */
+#define PORT_PRECOMPUTED_REG_IMAGES          ({PORT_PRECOMPUTED_REG_IMAGES})
+
+/*
+ * Pre-compile option for moving the used ports to the AHB aperture in Port_Init instead of the legacy APB aperture.
+ * The Dio Driver uses the base addresses of the Port Driver so it always follows this option.
+ */
+#define PORT_GPIO_AHB_APERTURE               ({PORT_GPIO_AHB_APERTURE})
+
+/* Pre-compile option for the RAM shadow of the direction and mode registers, so the APIs never read them back */
+#define PORT_SHADOW_REGISTERS                ({PORT_SHADOW_REGISTERS})
+
+/* Pre-compile option for the edge interrupts of the input pins and the GPIO Port ISRs */
+#define PORT_EDGE_INTERRUPTS                 ({PORT_EDGE_INTERRUPTS})
+"""
+
+PORT_CFG_H_TAIL = """
+/* Microcontroller Port Pin Mode ID's */
+#define PORT_PIN_MODE_DIO              (uint8)0
+#define PORT_PIN_MODE_ADC              (uint8)1
+#define PORT_PIN_MODE_UART             (uint8)2
+#define PORT_PIN_MODE_SSI              (uint8)3
+#define PORT_PIN_MODE_I2C              (uint8)4
+#define PORT_PIN_MODE_CAN              (uint8)5
+#define PORT_PIN_MODE_USB              (uint8)6
+#define PORT_PIN_MODE_GPT              (uint8)7
+#define PORT_PIN_MODE_PWM              (uint8)8
+#define PORT_PIN_MODE_QEI              (uint8)9
+#define PORT_PIN_MODE_ANALOG_COMP      (uint8)10
+#define PORT_PIN_MODE_NMI              (uint8)11
+#define PORT_PIN_MODE_TRACE            (uint8)12
+
+/* Port Configured Port ID's */
+#define PORT_A          (uint8)0
+#define PORT_B          (uint8)1
+#define PORT_C          (uint8)2
+#define PORT_D          (uint8)3
+#define PORT_E          (uint8)4
+#define PORT_F          (uint8)5
+
+/* Port Configured Port Pin ID's */
+#define PIN_0          (uint8)0
+#define PIN_1          (uint8)1
+#define PIN_2          (uint8)2
+#define PIN_3          (uint8)3
+#define PIN_4          (uint8)4
+#define PIN_5          (uint8)5
+#define PIN_6          (uint8)6
+#define PIN_7          (uint8)7
+
+/* Port Pin ID numbers */
+{pin_ids}
+/* Number of the GPIO Ports in the Microcontroller */
+#define PORT_NUMBER_OF_PORTS            (6U)
+
+/* Number of the configured Port Pins */
+#define PORT_NUMBER_OF_PORT_PINS        ({num_pins}U)
+
+/* Number of the configured Port Pin Modes */
+#define PORT_NUMBER_OF_PORT_PIN_MODES      (13U)
+
+#endif /* PORT_CFG_H */
+"""
+
+PORT_PBCFG_C_HEAD = """ /******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Port Driver
+ *              Generated by Tools/Port_Gen.py from {source}
+ *
+ * Author: Ahmed Essam
+ ******************************************************************************/
+
+/*
+ * Module Version 1.0.0
+ */
+#define PORT_PBCFG_SW_MAJOR_VERSION              (1U)
+#define PORT_PBCFG_SW_MINOR_VERSION              (0U)
+#define PORT_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define PORT_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define PORT_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define PORT_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+#include "Port.h"
+
+/* AUTOSAR Version checking between Port_PBcfg.c and Port.h files */
+#if ((PORT_PBCFG_AR_RELEASE_MAJOR_VERSION != PORT_AR_RELEASE_MAJOR_VERSION)\\
+ ||  (PORT_PBCFG_AR_RELEASE_MINOR_VERSION != PORT_AR_RELEASE_MINOR_VERSION)\\
+ ||  (PORT_PBCFG_AR_RELEASE_PATCH_VERSION != PORT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Port_PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Port_PBcfg.c and Port.h files */
+#if ((PORT_PBCFG_SW_MAJOR_VERSION != PORT_SW_MAJOR_VERSION)\\
+ ||  (PORT_PBCFG_SW_MINOR_VERSION != PORT_SW_MINOR_VERSION)\\
+ ||  (PORT_PBCFG_SW_PATCH_VERSION != PORT_SW_PATCH_VERSION))
+  #error "The SW version of Port_PBcfg.c does not match the expected version"
+#endif
+
+/* PB structure used with Port_Init API */
+const Port_ConfigType Port_Configuration = {{
+"""
+
+PORT_LCFG_C_HEAD = """ /******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Lcfg.c
+ *
+ * Description: Link Time Configuration Source file for TM4C123GH6PM Microcontroller - Port Driver
+ *              Generated by Tools/Port_Gen.py from the TM4C123GH6PM datasheet pin mux matrix
+ *
+ * Author: Ahmed Essam
+ ******************************************************************************/
+
+/*
+ * Module Version 1.0.0
+ */
+#define PORT_LCFG_SW_MAJOR_VERSION              (1U)
+#define PORT_LCFG_SW_MINOR_VERSION              (0U)
+#define PORT_LCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define PORT_LCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define PORT_LCFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define PORT_LCFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+#include "Port.h"
+
+/* AUTOSAR Version checking between Port_Lcfg.c and Port.h files */
+#if ((PORT_LCFG_AR_RELEASE_MAJOR_VERSION != PORT_AR_RELEASE_MAJOR_VERSION)\\
+ ||  (PORT_LCFG_AR_RELEASE_MINOR_VERSION != PORT_AR_RELEASE_MINOR_VERSION)\\
+ ||  (PORT_LCFG_AR_RELEASE_PATCH_VERSION != PORT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Port_Lcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Port_Lcfg.c and Port.h files */
+#if ((PORT_LCFG_SW_MAJOR_VERSION != PORT_SW_MAJOR_VERSION)\\
+ ||  (PORT_LCFG_SW_MINOR_VERSION != PORT_SW_MINOR_VERSION)\\
+ ||  (PORT_LCFG_SW_PATCH_VERSION != PORT_SW_PATCH_VERSION))
+  #error "The SW version of Port_Lcfg.c does not match the expected version"
+#endif
+
+/* Pin mux table used with Port_Init and Port_SetPinMode APIs, one entry per Port Pin and mode:
+ * {modes}
+ */
+const Port_PinModePmcType Port_PinModePmc[PORT_NUMBER_OF_PORT_PINS][PORT_NUMBER_OF_PORT_PIN_MODES] = {{
+"""
+
+
+def gen_port_lcfg_c():
+    out = PORT_LCFG_C_HEAD.format(modes=", ".join(MODES))
+    table = pin_mode_table()
+    for pin, row in enumerate(table):
+        port, num = PORT_PINS[pin]
+        if num == 0 and pin != 0:
+            out += "\n"
+        digital, analog = MUX_MATRIX[(port, num)]
+        signals = analog + [digital[pmc] for pmc in sorted(digital)]
+        out += "    {" + ", ".join("0x%04X" % entry for entry in row) + "}" + ("," if pin != len(table) - 1 else " ")
+        out += "    /* %s: %s */\n" % (pin_name(pin), " ".join(signals) if signals else "-")
+    out += "};\n"
+    return out
+
+
+def gen_port_cfg_h(options, source):
+    text = PORT_CFG_H.format(source=source, **{k: std_on_off(v) for k, v in options.items()})
+    pin_ids = ""
+    for pin, (port, num) in enumerate(PORT_PINS):
+        if num == 0 and pin != 0:
+            pin_ids += "\n"
+        pin_ids += "#define PORT_%s_PIN_%d    (Port_PinType)%d\n" % (port, num, pin)
+    return text + PORT_CFG_H_TAIL.format(pin_ids=pin_ids, num_pins=len(PORT_PINS))
+
+
+def gen_port_pbcfg_c(pins, options, source):
+    optional = options["PORT_OPTIONAL_CONFIG"]
+    indent = " " * 45
+    out = PORT_PBCFG_C_HEAD.format(source=source)
+    fields = "port pin mode, port_num, pin_num, directon, resistor, init value, changeable_pindirection, changeable_pinmode"
+    if optional:
+        fields += ", open drain mode, output current, slew rate control"
+    if options["PORT_EDGE_INTERRUPTS"]:
+        fields += ", edge interrupt"
+    out += indent + "/* Pins: " + fields + " */\n"
+    out += indent + "{\n"
+    for pin, cfg in enumerate(pins):
+        port, num = PORT_PINS[pin]
+        if num == 0:
+            if pin != 0:
+                out += "\n"
+            out += indent + "  /* PORT%s */\n" % port
+        mode = "PORT_PIN_MODE_" + cfg["mode"]
+        if cfg["pmc"]:
+            mode = "PORT_PIN_MODE_WITH_PMC(%s, %d)" % (mode, cfg["pmc"])
+        values = [mode, "PORT_" + port, "PIN_%d" % num,
+                  DIRECTIONS[cfg["direction"]], RESISTORS[cfg["resistor"]], LEVELS[cfg["level"]],
+                  std_on_off(cfg["direction_changeable"]), std_on_off(cfg["mode_changeable"])]
+        if optional:
+            values += [std_on_off(cfg["open_drain"]), cfg["current"],
+                       "STD_ACTIVE" if cfg["slew_rate"] else "STD_IDLE"]
+        if options["PORT_EDGE_INTERRUPTS"]:
+            values += [EDGES[cfg["edge"]]]
+        line = indent + "  {" + ", ".join(values) + "}" + ("," if pin != len(pins) - 1 else "")
+        if cfg["comment"]:
+            line += "    /* %s */" % cfg["comment"]
+        out += line + "\n"
+    out += indent + "}"
+    if options["PORT_PRECOMPUTED_REG_IMAGES"]:
+        fields, images = reg_images(pins, optional)
+        out += ",\n\n"
+        out += indent + "/* Ports register images: " + ", ".join(fields) + " */\n"
+        out += indent + "{\n"
+        for index, image in enumerate(images):
+            values = ["0x%02X" % image[f] for f in fields[:-1]] + ["0x%08XUL" % image["Pctl"]]
+            out += indent + "  {" + ", ".join(values) + "}" + ("," if index != len(images) - 1 else "")
+            out += "    /* PORT%s */\n" % PORTS[index]
+        out += indent + "}"
+    out += "\n" + indent[:-4] + "};\n"
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate Port_Cfg.h and Port_PBcfg.c from a JSON pin description")
+    parser.add_argument("config", help="JSON pin description")
+    parser.add_argument("-o", "--output", default=".", help="directory of the generated files")
+    args = parser.parse_args()
+
+    with open(args.config) as config_file:
+        config = json.load(config_file)
+    options = {
+        "PORT_DEV_ERROR_DETECT": True,
+        "PORT_SET_PIN_DIRECTION_API": True,
+        "PORT_SET_PIN_MODE_API": True,
+        "PORT_VERSION_INFO_API": True,
+        "PORT_OPTIONAL_CONFIG": False,
+        "PORT_PRECOMPUTED_REG_IMAGES": True,
+        "PORT_GPIO_AHB_APERTURE": True,
+        "PORT_SHADOW_REGISTERS": True,
+        "PORT_EDGE_INTERRUPTS": False,
+    }
+    options.update(config.get("options", {}))
+    try:
+        pins = load_pins(config)
+    except ConfigError as error:
+        sys.stderr.write("%s: error: %s\n" % (args.config, error))
+        return 1
+
+    source = os.path.basename(args.config)
+    for name, text in (("Port_Cfg.h", gen_port_cfg_h(options, source)),
+                       ("Port_PBcfg.c", gen_port_pbcfg_c(pins, options, source)),
+                       ("Port_Lcfg.c", gen_port_lcfg_c())):
+        with open(os.path.join(args.output, name), "w", newline="\r\n") as out_file:
+            out_file.write(text)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
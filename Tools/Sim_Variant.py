@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+###############################################################################
+#
+# Module: Sim
+#
+# File Name: Sim_Variant.py
+#
+# Description: Creates a copy of the driver sources with some pre-compile options changed,
+#              used by the Makefile to build the host tests and benchmarks of a configuration
+#              other than the shipped one. The configuration headers are included with quotes
+#              from the directory of the driver files, so a changed header only takes effect
+#              in a copy of the whole tree.
+#
+# Usage: python3 Tools/Sim_Variant.py OUTPUT_DIRECTORY [FILE:OPTION=VALUE ...]
+#        e.g. Dio_Cfg.h:DIO_CHANNEL_ACCESS_MODE=(DIO_ACCESS_BIT_BAND)
+#
+# Author: Mohamed Tarek
+###############################################################################
+
+import argparse
+import glob
+import os
+import re
+import shutil
+import sys
+
+# Source directories copied with the driver files of the top directory
+SOURCE_DIRS = ["Sim", "Bench", "Test"]
+
+
+class OptionError(Exception):
+    pass
+
+
+def set_option(text, option, value):
+    """Replace the value of the #define of an option, keeping the alignment and the line ending."""
+    pattern = re.compile(r"^(#define[ \t]+%s[ \t]+)[^\r\n]*" % re.escape(option), re.MULTILINE)
+    text, count = pattern.subn(lambda match: match.group(1) + value, text)
+    if count != 1:
+        raise OptionError("%s is defined %d times" % (option, count))
+    return text
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Copy the driver sources with some pre-compile options changed")
+    parser.add_argument("output", help="directory of the copy, replaced if it exists")
+    parser.add_argument("options", nargs="*", metavar="FILE:OPTION=VALUE", help="option to change in a header")
+    args = parser.parse_args()
+
+    if os.path.exists(args.output):
+        shutil.rmtree(args.output)
+    os.makedirs(args.output)
+    for name in glob.glob("*.c") + glob.glob("*.h"):
+        shutil.copy2(name, args.output)
+    for name in SOURCE_DIRS:
+        shutil.copytree(name, os.path.join(args.output, name))
+
+    for item in args.options:
+        try:
+            header, assignment = item.split(":", 1)
+            option, value = assignment.split("=", 1)
+            path = os.path.join(args.output, header)
+            with open(path, newline="") as header_file:
+                text = header_file.read()
+            text = set_option(text, option, value)
+            with open(path, "w", newline="") as header_file:
+                header_file.write(text)
+        except (ValueError, OSError, OptionError) as error:
+            sys.stderr.write("%s: error: %s\n" % (item, error))
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
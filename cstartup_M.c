@@ -23,6 +23,13 @@ extern void SVC_Handler( void );
 extern void DebugMon_Handler( void );
 extern void PendSV_Handler( void );
 extern void SysTick_Handler( void );
+extern void IntDefault_Handler( void );
+extern void GPIOPortA_Handler( void );
+extern void GPIOPortB_Handler( void );
+extern void GPIOPortC_Handler( void );
+extern void GPIOPortD_Handler( void );
+extern void GPIOPortE_Handler( void );
+extern void GPIOPortF_Handler( void );
 
 typedef void( *intfunc )( void );
 typedef union { intfunc __fun; void * __ptr; } intvec_elem;
@@ -56,7 +63,40 @@ const intvec_elem __vector_table[] =
   DebugMon_Handler,
   0,
   PendSV_Handler,
-  SysTick_Handler
+  SysTick_Handler,
+
+  // TM4C123GH6PM interrupts
+  GPIOPortA_Handler,        // IRQ 0  GPIO Port A
+  GPIOPortB_Handler,        // IRQ 1  GPIO Port B
+  GPIOPortC_Handler,        // IRQ 2  GPIO Port C
+  GPIOPortD_Handler,        // IRQ 3  GPIO Port D
+  GPIOPortE_Handler,        // IRQ 4  GPIO Port E
+  IntDefault_Handler,       // IRQ 5
+  IntDefault_Handler,       // IRQ 6
+  IntDefault_Handler,       // IRQ 7
+  IntDefault_Handler,       // IRQ 8
+  IntDefault_Handler,       // IRQ 9
+  IntDefault_Handler,       // IRQ 10
+  IntDefault_Handler,       // IRQ 11
+  IntDefault_Handler,       // IRQ 12
+  IntDefault_Handler,       // IRQ 13
+  IntDefault_Handler,       // IRQ 14
+  IntDefault_Handler,       // IRQ 15
+  IntDefault_Handler,       // IRQ 16
+  IntDefault_Handler,       // IRQ 17
+  IntDefault_Handler,       // IRQ 18
+  IntDefault_Handler,       // IRQ 19
+  IntDefault_Handler,       // IRQ 20
+  IntDefault_Handler,       // IRQ 21
+  IntDefault_Handler,       // IRQ 22
+  IntDefault_Handler,       // IRQ 23
+  IntDefault_Handler,       // IRQ 24
+  IntDefault_Handler,       // IRQ 25
+  IntDefault_Handler,       // IRQ 26
+  IntDefault_Handler,       // IRQ 27
+  IntDefault_Handler,       // IRQ 28
+  IntDefault_Handler,       // IRQ 29
+  GPIOPortF_Handler         // IRQ 30 GPIO Port F
 
 };
 
@@ -78,6 +118,20 @@ __weak void DebugMon_Handler( void ) { while (1) {} }
 __weak void PendSV_Handler( void ) { while (1) {} }
 #pragma call_graph_root = "interrupt"
 __weak void SysTick_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void IntDefault_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOPortA_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOPortB_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOPortC_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOPortD_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOPortE_Handler( void ) { while (1) {} }
+#pragma call_graph_root = "interrupt"
+__weak void GPIOPortF_Handler( void ) { while (1) {} }
 
 
 void __cmain( void );